@@ -61,6 +61,12 @@ with-tcc: no
 ;
 pre-vista: no
 
+; Allow the garbage collector to use helper threads in its mark phase (see
+; RECYCLE/PARALLEL).  Requires POSIX threads, and only affects builds that
+; don't have asserts enabled.
+;
+parallel-mark: no
+
 
 git-commit: _
 
@@ -720,6 +720,24 @@ append app-config/definitions opt switch/default user-config/pre-vista [
     fail ["PRE-VISTA must be yes, no, or logic! not" (user-config/pre-vista)]
 ]
 
+; parallel-mark switch
+;
+append app-config/definitions opt switch/default user-config/parallel-mark [
+    #[true] 'yes 'on 'true [
+        append app-config/cflags <gnu:-pthread>
+        append app-config/ldflags <gnu:-pthread>
+        ["GC_PARALLEL_MARK"]
+    ]
+    _ #[false] 'no 'off 'false [
+        _
+    ]
+][
+    fail [
+        "PARALLEL-MARK must be yes, no, or logic! not"
+        (user-config/parallel-mark)
+    ]
+]
+
 cfg-rigorous: false
 append app-config/cflags opt switch/default user-config/rigorous [
     #[true] 'yes 'on 'true [
@@ -363,6 +363,8 @@ sort: action [
     limit [any-number! any-series!] {Length of series to sort}
     /all {Compare all fields}
     /reverse {Reverse sort order}
+    /key {Sort records by what a function returns for each of them}
+    keyer [action!]
 ]
 
 ;-- Port actions:
@@ -139,6 +139,14 @@ options: construct [] [  ; Options supplied to REBOL during startup
 
     binary-base: 16    ; Default base for FORMed binary values (64, 16, 2)
     decimal-digits: 15 ; Max number of decimal digits to print.
+
+    ; Auto-recycles run once the memory allocated since the last one reaches
+    ; the live memory it left times (gc-growth - 1), kept within the bounds
+    ; (the bounds are in bytes, and a BLANK! gc-growth uses just the minimum)
+    ;
+    gc-growth: 2.0
+    gc-min-ballast: 3000000
+    gc-max-ballast: 1000000000
     module-paths: [%./]
     default-suffix: %.reb ; Used by IMPORT if no suffix is provided
     file-types: copy [
@@ -241,6 +249,13 @@ standard: construct [] [
             _ ;-- changed to null below
     ]
 
+    memoized-meta: construct [] [
+        description:
+        inner:
+        inner-name:
+            _ ;-- changed to null below
+    ]
+
     chained-meta: construct [] [
         description:
         chainees:
@@ -255,7 +270,7 @@ standard: construct [] [
         ;
         for-each m reduce [
             action-meta specialized-meta adapted-meta
-            enclosed-meta chained-meta
+            enclosed-meta memoized-meta chained-meta
         ][
             for-each [key val] m [
                 m/(key): opt m/(key)
@@ -409,6 +424,30 @@ standard: construct [] [
             _
     ]
 
+    gc-stats: construct [] [ ; garbage collector stats (see STATS/GC)
+        recycles:           ; number of recycles run
+        pause-time:         ; total time spent paused in recycles
+        released:           ; bytes of pool memory given back to the OS
+        live:               ; bytes in use after the last full recycle
+        ballast:            ; bytes to allocate before the next auto-recycle
+        root-time:          ; total time spent marking the root set
+        stack-time:         ; total time spent marking from the frame stack
+        propagate-time:     ; total time spent marking what those reach
+        sweep-time:         ; total time sweeping in recycles (not allocations)
+        freed:              ; number of nodes freed (series, pairings, GOB!s)
+        reclaimed:          ; bytes freed with those nodes
+        pauses:             ; recycle pauses under 100us/1ms/10ms/100ms/1s/more
+            _
+    ]
+
+    memo-stats: construct [] [ ; cache stats of a MEMOIZE action (MEMO-STATS)
+        hits:               ; calls answered with a remembered result
+        misses:             ; calls that had to run the inner action
+        size:               ; results currently remembered
+        capacity:           ; results remembered before evicting the oldest
+            _
+    ]
+
     type-spec: construct [] [
         title:
         type:
@@ -1762,6 +1762,8 @@ REBVAL *RL_rebManage(REBVAL *v)
         fail ("Attempt to rebManage() a handle that's already managed.");
 
     SET_SER_FLAG(a, NODE_FLAG_MANAGED);
+    if (GC_Sweep_Seg != NULL)
+        Keep_Series_From_Sweep(SER(a));
     assert(LINK(a).owner == UNBOUND);
     if (not FS_TOP)
         LINK(a).owner = UNBOUND;
@@ -1802,7 +1804,9 @@ void RL_rebUnmanage(void *p)
     // pointers to its cell being held by client C code only.  It's at their
     // own risk to do this, and not use those pointers after a free.
     //
-    CLEAR_SER_FLAG(a, NODE_FLAG_MANAGED);
+    // (The handle may be marked if a lazy sweep is pending, see %m-gc.c)
+    //
+    CLEAR_SER_FLAGS(a, NODE_FLAG_MANAGED | NODE_FLAG_MARKED);
     assert(
         LINK(a).owner == UNBOUND // freed when program exits
         or GET_SER_FLAG(LINK(a).owner, ARRAY_FLAG_VARLIST)
@@ -1143,6 +1143,7 @@ void Startup_Core(void)
     PG_Boot_Level = BOOT_LEVEL_FULL;
     PG_Mem_Usage = 0;
     PG_Mem_Limit = 0;
+    PG_Mem_Released = 0;
     Reb_Opts = ALLOC(REB_OPTS);
     CLEAR(Reb_Opts, sizeof(REB_OPTS));
     Saved_State = NULL;
@@ -1186,6 +1187,10 @@ void Startup_Core(void)
 //==//////////////////////////////////////////////////////////////////////==//
 
     Init_Root_Vars();    // Special REBOL values per program
+    Startup_Alloc_Profiler();
+    Startup_Profiler();
+    Startup_Loop_Bodies();
+    Startup_Find_Indexes();
 
 //==//////////////////////////////////////////////////////////////////////==//
 //
@@ -1455,6 +1460,10 @@ void Shutdown_Core(void)
 
     Shutdown_Action_Meta_Shim();
     Shutdown_Action_Spec_Tags();
+    Shutdown_Find_Indexes();
+    Shutdown_Loop_Bodies();
+    Shutdown_Profiler();
+    Shutdown_Alloc_Profiler();
     Shutdown_Root_Vars();
 
     const REBOOL shutdown = true; // go ahead and free all managed series
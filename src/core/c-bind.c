@@ -365,6 +365,329 @@ void Rebind_Values_Deep(
 }
 
 
+// Loops run from function bodies are given the same frozen body block every
+// time they run.  Rather than deep copy and bind that body on each run, the
+// loop's body is copied and bound once into a "template", which is kept in
+// Root_Loop_Bodies.  The template's loop words are bound to a context that
+// is never run.
+//
+// Each run of the loop still copies all of the template's arrays, as the
+// deep copy would: the body may hand out its blocks to be changed, as with
+// `b: [] append b x`.  But instead of searching the context for every word,
+// it only moves the binding of the loop words to a new context sharing the
+// template context's keylist.  A body with no arrays or loop words in it is
+// run as is.
+//
+#define LOOP_BODY_CACHE_SIZE 64 // must be a power of 2
+
+enum {
+    LOOP_BODY_ORIGINAL, // BLOCK! of the body as given to the loop
+    LOOP_BODY_SPEC, // WORD! or BLOCK! spec of the loop variables
+    LOOP_BODY_TEMPLATE, // BLOCK! of the bound copy of the body
+    LOOP_BODY_CONTEXT, // OBJECT! that the template's loop words are bound to
+    LOOP_BODY_MAX
+};
+
+
+//
+//  Startup_Loop_Bodies: C
+//
+void Startup_Loop_Bodies(void)
+{
+    REBCNT len = LOOP_BODY_CACHE_SIZE * LOOP_BODY_MAX;
+    REBARR *a = Make_Array(len);
+
+    REBCNT n;
+    for (n = 0; n < len; ++n)
+        Init_Blank(ARR_AT(a, n));
+    TERM_ARRAY_LEN(a, len);
+
+    Root_Loop_Bodies = Init_Block(Alloc_Value(), a);
+}
+
+
+//
+//  Shutdown_Loop_Bodies: C
+//
+void Shutdown_Loop_Bodies(void)
+{
+    rebRelease(Root_Loop_Bodies);
+    Root_Loop_Bodies = NULL;
+}
+
+
+// Copy the cells of a body array (from `index`) as they are, so relative
+// values stay relative.
+//
+static REBARR *Copy_Loop_Body_Cells(REBARR *original, REBCNT index)
+{
+    REBCNT len = ARR_LEN(original) - index;
+    REBARR *copy = Make_Array_For_Copy(len, ARRAY_FLAG_FILE_LINE, original);
+
+    const RELVAL *s = ARR_AT(original, index);
+    RELVAL *d = ARR_HEAD(copy);
+    for (; NOT_END(s); ++s, ++d) {
+        Move_Value_Header(d, s);
+        d->payload = s->payload;
+        d->extra = s->extra;
+    }
+    TERM_ARRAY_LEN(copy, len);
+    return copy;
+}
+
+
+// Make the template copy of a body array (from `index`), or return NULL if
+// it has no arrays or words bound by the loop in it so it needn't be copied.
+// Cells are copied without being derelativized, so the template of a body
+// inside a function body is relative to that function like the original is.
+//
+// The copies are left unmanaged until the template is done, because the GC
+// would not see them in the unmanaged arrays they are put in.
+//
+static REBARR *Prebind_Loop_Body(
+    REBARR *original,
+    REBCNT index,
+    REBCTX *context
+){
+    if (C_STACK_OVERFLOWING(&index))
+        Fail_Stack_Overflow();
+
+    assert(GET_SER_INFO(original, SERIES_INFO_FROZEN));
+
+    REBARR *copy = NULL;
+
+    const RELVAL *src = ARR_AT(original, index);
+    REBCNT n = 0;
+    for (; NOT_END(src); ++src, ++n) {
+        REBARR *sub = NULL;
+        REBCNT i = 0;
+        if (ANY_ARRAY(src)) {
+            sub = Prebind_Loop_Body(VAL_ARRAY(src), 0, context);
+            if (sub == NULL) // no arrays or loop words, copy it anyway
+                sub = Copy_Loop_Body_Cells(VAL_ARRAY(src), 0);
+        }
+        else if (ANY_WORD(src)) {
+            const REBOOL always = FALSE;
+            i = Find_Canon_In_Context(context, VAL_WORD_CANON(src), always);
+            if (i == 0)
+                continue;
+        }
+        else
+            continue;
+
+        if (copy == NULL)
+            copy = Copy_Loop_Body_Cells(original, index);
+
+        RELVAL *dest = ARR_AT(copy, n);
+        if (sub != NULL)
+            dest->payload.any_series.series = SER(sub);
+        else {
+            INIT_BINDING(dest, context);
+            INIT_WORD_INDEX(dest, i);
+        }
+    }
+
+    return copy;
+}
+
+
+// All of the arrays in a template are copies made by Prebind_Loop_Body().
+//
+static void Manage_Loop_Body(REBARR *a)
+{
+    MANAGE_ARRAY(a);
+
+    RELVAL *v = ARR_HEAD(a);
+    for (; NOT_END(v); ++v) {
+        if (ANY_ARRAY(v))
+            Manage_Loop_Body(VAL_ARRAY(v));
+    }
+}
+
+
+// Copy the arrays of a template that has been shallow copied into `head`,
+// and bind its loop words to `to` instead of `from`.
+//
+static void Instantiate_Loop_Body(
+    RELVAL *head,
+    REBSPC *specifier,
+    REBCTX *from,
+    REBCTX *to
+){
+    RELVAL *v = head;
+    for (; NOT_END(v); ++v) {
+        if (ANY_WORD(v)) {
+            if (VAL_BINDING(v) == NOD(CTX_VARLIST(from)))
+                INIT_BINDING(v, to);
+        }
+        else if (ANY_ARRAY(v)) {
+            REBSPC *derived = Derive_Specifier(specifier, v);
+            REBARR *copy = Copy_Array_At_Extra_Shallow(
+                VAL_ARRAY(v), 0, derived, 0, ARRAY_FLAG_FILE_LINE
+            );
+            INIT_VAL_ARRAY(v, copy); // copies args
+            INIT_BINDING(v, UNBOUND); // copy has no relative values
+            MANAGE_ARRAY(copy);
+
+            Instantiate_Loop_Body(ARR_HEAD(copy), derived, from, to);
+        }
+    }
+}
+
+
+// Make the template for a loop body and its spec, and put it in the cache
+// entry.  Returns FALSE if a template can't be made from the spec.
+//
+static REBOOL Make_Loop_Body_Template(
+    RELVAL *entry,
+    const REBVAL *body_in,
+    const REBVAL *spec
+){
+    REBARR *body = VAL_ARRAY(body_in);
+    RELVAL *cached_spec = entry + LOOP_BODY_SPEC;
+
+    REBCNT num_vars = IS_BLOCK(spec) ? VAL_LEN_AT(spec) : 1;
+    if (num_vars == 0)
+        return FALSE;
+
+    REBCTX *context = Alloc_Context(REB_OBJECT, num_vars);
+
+    REBVAL *key = CTX_KEYS_HEAD(context);
+    REBVAL *var = CTX_VARS_HEAD(context);
+    const RELVAL *item = IS_BLOCK(spec) ? VAL_ARRAY_AT(spec) : spec;
+    for (; NOT_END(item); ++item, ++key, ++var) {
+        REBVAL *prior = CTX_KEYS_HEAD(context);
+        for (; prior != key; ++prior) {
+            if (VAL_KEY_CANON(prior) == VAL_WORD_CANON(item)) {
+                Free_Array(CTX_VARLIST(context));
+                return FALSE; // let the loop give the duplicate error
+            }
+        }
+
+        Init_Typeset(key, ALL_64, VAL_WORD_SPELLING(item));
+        Init_Void(var);
+
+        if (IS_WORD(spec))
+            break;
+    }
+    TERM_ARRAY_LEN(CTX_VARLIST(context), num_vars + 1);
+    TERM_ARRAY_LEN(CTX_KEYLIST(context), num_vars + 1);
+    MANAGE_ARRAY(CTX_VARLIST(context));
+
+    PUSH_GUARD_CONTEXT(context);
+    REBARR *prebound = Prebind_Loop_Body(
+        body, VAL_INDEX(body_in), context
+    );
+    DROP_GUARD_CONTEXT(context);
+
+    if (prebound == NULL) // nothing to copy or bind, so run the original
+        prebound = body;
+    else
+        Manage_Loop_Body(prebound);
+
+    Init_Any_Array_At(
+        entry + LOOP_BODY_ORIGINAL,
+        REB_BLOCK,
+        body,
+        VAL_INDEX(body_in)
+    );
+    if (IS_BLOCK(spec))
+        Init_Any_Array_At(
+            cached_spec, REB_BLOCK, VAL_ARRAY(spec), VAL_INDEX(spec)
+        );
+    else
+        Init_Word(cached_spec, VAL_WORD_SPELLING(spec));
+    Init_Any_Array_At(
+        entry + LOOP_BODY_TEMPLATE,
+        REB_BLOCK,
+        prebound,
+        prebound == body ? VAL_INDEX(body_in) : 0
+    );
+    Init_Object(entry + LOOP_BODY_CONTEXT, context);
+
+    return TRUE;
+}
+
+
+// If the body and spec of the loop are eligible, bind the body through its
+// template (making the template if need be) and return TRUE.  Otherwise
+// return FALSE, and the loop copies and binds the body itself.
+//
+static REBOOL Try_Bind_Loop_Body_From_Template(
+    REBVAL *body_in_out,
+    REBCTX **context_out,
+    const REBVAL *spec
+){
+    REBARR *body = VAL_ARRAY(body_in_out);
+    if (NOT_SER_INFO(body, SERIES_INFO_FROZEN))
+        return FALSE;
+
+    if (IS_BLOCK(spec)) {
+        if (NOT_SER_INFO(VAL_ARRAY(spec), SERIES_INFO_FROZEN))
+            return FALSE;
+
+        const RELVAL *item = VAL_ARRAY_AT(spec);
+        for (; NOT_END(item); ++item) {
+            if (not IS_WORD(item))
+                return FALSE; // LIT-WORD!s keep a binding of each run
+        }
+    }
+    else if (not IS_WORD(spec))
+        return FALSE;
+
+    REBCNT slot = (
+        (cast(uintptr_t, body) >> 4) + VAL_INDEX(body_in_out)
+    ) & (LOOP_BODY_CACHE_SIZE - 1);
+
+    RELVAL *entry = ARR_AT(
+        VAL_ARRAY(Root_Loop_Bodies), slot * LOOP_BODY_MAX
+    );
+    RELVAL *cached_spec = entry + LOOP_BODY_SPEC;
+
+    if (
+        IS_BLOCK(entry + LOOP_BODY_ORIGINAL)
+        and VAL_ARRAY(entry + LOOP_BODY_ORIGINAL) == body
+        and VAL_INDEX(entry + LOOP_BODY_ORIGINAL) == VAL_INDEX(body_in_out)
+        and (
+            IS_WORD(spec)
+                ? IS_WORD(cached_spec)
+                    and VAL_WORD_SPELLING(cached_spec)
+                        == VAL_WORD_SPELLING(spec)
+                : IS_BLOCK(cached_spec)
+                    and VAL_ARRAY(cached_spec) == VAL_ARRAY(spec)
+                    and VAL_INDEX(cached_spec) == VAL_INDEX(spec)
+        )
+    ){
+        // cache hit, the template in the entry can be used
+    }
+    else if (not Make_Loop_Body_Template(entry, body_in_out, spec))
+        return FALSE;
+
+    REBCTX *from = VAL_CONTEXT(entry + LOOP_BODY_CONTEXT);
+    REBCTX *c = Copy_Context_Shallow_Extra(from, 0);
+    SET_SER_FLAG(CTX_VARLIST(c), SERIES_FLAG_DONT_RELOCATE); // #2274
+    MANAGE_ARRAY(CTX_VARLIST(c));
+    *context_out = c;
+
+    RELVAL *tmpl = entry + LOOP_BODY_TEMPLATE;
+    if (VAL_ARRAY(tmpl) == body)
+        return TRUE; // body_in_out can be run as is
+
+    REBSPC *specifier = VAL_SPECIFIER(body_in_out);
+    REBARR *copy = Copy_Array_At_Extra_Shallow(
+        VAL_ARRAY(tmpl), 0, specifier, 0, ARRAY_FLAG_FILE_LINE
+    );
+    MANAGE_ARRAY(copy);
+    Init_Block(body_in_out, copy);
+
+    PUSH_GUARD_CONTEXT(c);
+    Instantiate_Loop_Body(VAL_ARRAY_HEAD(body_in_out), specifier, from, c);
+    DROP_GUARD_CONTEXT(c);
+
+    return TRUE;
+}
+
+
 //
 //  Virtual_Bind_Deep_To_New_Context: C
 //
@@ -415,6 +738,9 @@ void Virtual_Bind_Deep_To_New_Context(
 ) {
     assert(IS_BLOCK(body_in_out));
 
+    if (Try_Bind_Loop_Body_From_Template(body_in_out, context_out, spec))
+        return;
+
     REBCNT num_vars = IS_BLOCK(spec) ? VAL_LEN_AT(spec) : 1;
     if (num_vars == 0)
         fail (Error_Invalid(spec));
@@ -115,6 +115,85 @@ REBCTX *Alloc_Context(enum Reb_Kind kind, REBCNT capacity)
 }
 
 
+// Contexts with fewer keys than this are searched by scanning the keylist.
+//
+#define MIN_KEYS_FOR_KEYHASH 32
+
+inline static REBCNT Keyhash_Start(REBSTR *canon, REBCNT mask) {
+    uintptr_t bits = cast(uintptr_t, canon) >> 4; // nodes are aligned
+    return cast(REBCNT, (bits * 2654435761u) >> 8) & mask;
+}
+
+
+//
+// Big keylists (`lib`, `system`, objects made from JSON...) have a table
+// from canon spellings to key indices in their ->misc, so it's shared by all
+// the contexts using the keylist.  Slot [0] of the table is the number of
+// keys it has indexed, followed by a power-of-2 number of slots holding a
+// key index (or 0 if empty) found by linear probing.
+//
+// Keys are only ever added to the end of a keylist.  So this just indexes
+// any that were added since the last update, building a bigger table first
+// if the new keys would make it more than half full.
+//
+static void Update_Keyhash(REBARR *keylist)
+{
+    REBCNT len = ARR_LEN(keylist) - 1; // don't count the rootkey
+
+    REBSER *table;
+    REBCNT size;
+    REBCNT done;
+    if (GET_SER_FLAG(keylist, ARRAY_FLAG_KEYHASH)) {
+        table = MISC(keylist).keyhash;
+        size = SER_LEN(table) - 1;
+        done = *SER_HEAD(REBCNT, table);
+        if (done == len)
+            return;
+    }
+    else {
+        table = NULL;
+        size = 0;
+        done = 0;
+    }
+
+    if (len * 2 > size) {
+        size = MIN_KEYS_FOR_KEYHASH;
+        while (size < len * 4)
+            size *= 2;
+
+        table = Make_Series(size + 1, sizeof(REBCNT));
+        memset(SER_DATA_RAW(table), 0, (size + 1) * sizeof(REBCNT));
+        SET_SERIES_LEN(table, size + 1);
+        MANAGE_SERIES(table);
+
+        // The ->misc of a keylist may have been a line number, if it was
+        // made with Make_Array()...but keylists aren't source code.
+        //
+        CLEAR_SER_FLAG(keylist, ARRAY_FLAG_FILE_LINE);
+        MISC(keylist).keyhash = table;
+        SET_SER_FLAG(keylist, ARRAY_FLAG_KEYHASH);
+        done = 0;
+    }
+
+    REBCNT *slots = SER_HEAD(REBCNT, table) + 1;
+    REBCNT mask = size - 1;
+
+    REBCNT n;
+    for (n = done + 1; n <= len; ++n) {
+        REBSTR *canon = VAL_KEY_CANON(ARR_AT(keylist, n));
+        REBCNT i = Keyhash_Start(canon, mask);
+        for (; slots[i] != 0; i = (i + 1) & mask) {
+            if (VAL_KEY_CANON(ARR_AT(keylist, slots[i])) == canon)
+                break; // a duplicate key, scanning would find the first
+        }
+        if (slots[i] == 0)
+            slots[i] = n;
+    }
+
+    *SER_HEAD(REBCNT, table) = len;
+}
+
+
 //
 //  Expand_Context_Keylist_Core: C
 //
@@ -239,6 +318,9 @@ REBVAL *Append_Context(
     REBVAL *value = Init_Void(ARR_LAST(CTX_VARLIST(context)));
     TERM_ARRAY_LEN(CTX_VARLIST(context), ARR_LEN(CTX_VARLIST(context)));
 
+    if (GET_SER_FLAG(keylist, ARRAY_FLAG_KEYHASH))
+        Update_Keyhash(keylist);
+
     if (opt_any_word) {
         REBCNT len = CTX_LEN(context);
 
@@ -1332,7 +1414,8 @@ void Resolve_Context(
 //  Find_Canon_In_Context: C
 //
 // Search a context looking for the given canon symbol.  Return the index or
-// 0 if not found.
+// 0 if not found.  Big contexts other than FRAME!s look it up in a table
+// kept with their keylist (see Update_Keyhash()).
 //
 REBCNT Find_Canon_In_Context(REBCTX *context, REBSTR *canon, REBOOL always)
 {
@@ -1341,6 +1424,31 @@ REBCNT Find_Canon_In_Context(REBCTX *context, REBSTR *canon, REBOOL always)
     REBVAL *key = CTX_KEYS_HEAD(context);
     REBCNT len = CTX_LEN(context);
 
+    if (len >= MIN_KEYS_FOR_KEYHASH and CTX_TYPE(context) != REB_FRAME) {
+        REBARR *keylist = CTX_KEYLIST(context); // FRAME!s use a paramlist
+        Update_Keyhash(keylist);
+
+        REBSER *table = MISC(keylist).keyhash;
+        REBCNT *slots = SER_HEAD(REBCNT, table) + 1;
+        REBCNT mask = SER_LEN(table) - 2;
+
+        REBCNT i = Keyhash_Start(canon, mask);
+        for (; slots[i] != 0; i = (i + 1) & mask) {
+            REBCNT n = slots[i];
+            if (canon != VAL_KEY_CANON(key + n - 1))
+                continue;
+
+            if (n > len) // keylist is shared with a longer context
+                return 0;
+            if (GET_VAL_FLAG(key + n - 1, TYPESET_FLAG_UNBINDABLE)) {
+                if (not always)
+                    return 0;
+            }
+            return n;
+        }
+        return 0;
+    }
+
     REBCNT n;
     for (n = 1; n <= len; n++, key++) {
         if (canon == VAL_KEY_CANON(key)) {
@@ -474,6 +474,11 @@ void Set_Location_Of_Error(
 
         DS_PUSH_TRASH;
         Get_Frame_Label_Or_Blank(DS_TOP, f);
+
+        if (f->flags.bits & DO_FLAG_TAIL_CALLED) { // callers' frames reused
+            DS_PUSH_TRASH;
+            Init_Word(DS_TOP, Canon(SYM_ELLIPSIS));
+        }
     }
     Init_Block(&vars->where, Pop_Stack_Values(dsp_orig));
 
@@ -50,6 +50,7 @@
 //
 
 #include "sys-core.h"
+#include "sys-int-funcs.h" // REB_I64_ADD_OF()
 
 
 #if defined(DEBUG_COUNT_TICKS)
@@ -292,6 +293,604 @@ inline static void Finalize_Current_Arg(REBFRM *f) {
 }
 
 
+//
+// Numeric loops spend most of their time in things like `i + 1` and `x < n`,
+// where pushing a frame for the operator and going through REBTYPE(Integer)
+// or Compare_Modify_Values() costs far more than the math.  This is called
+// when f->gotten is an enfix action about to take f->out as its left hand
+// argument.  If the action is a stock math or comparison operator (checked
+// by dispatcher, so a HIJACK or SPECIALIZE of it is noticed) and both sides
+// are INTEGER! or DECIMAL!, the result is written to f->out and the frame
+// is advanced past the operator and its right hand argument.
+//
+// The right hand side must be a literal or a WORD! looking up to a number,
+// and what comes after it must not be something the argument gathering
+// could have taken as well (such as enfix on a non-#tight argument, or any
+// "invisible").  Results that would be errors, like overflows or division
+// by zero, are left to the action to report.
+//
+// Returns FALSE with `f` untouched if the action needs to be called.
+//
+static REBOOL Do_Quick_Math_Maybe(REBFRM *f)
+{
+    if (PG_Do != &Do_Core or PG_Apply != &Apply_Core)
+        return FALSE; // tracing and METRICS want to see every call
+
+    if (FRM_IS_VALIST(f))
+        return FALSE; // can't peek at what comes after the right hand side
+
+    enum Reb_Kind kind1 = VAL_TYPE(f->out);
+    if (kind1 != REB_INTEGER and kind1 != REB_DECIMAL)
+        return FALSE;
+
+    REBACT *act = VAL_ACTION(f->gotten);
+    if (ACT_EXEMPLAR(act) != NULL or ACT_FACADE_NUM_PARAMS(act) != 2)
+        return FALSE;
+
+    REBSYM verb = SYM_0; // for math, else a comparison via strictness
+    REBINT strictness = 0;
+    REBOOL negate = FALSE;
+
+    REBNAT dispatcher = ACT_DISPATCHER(act);
+    if (dispatcher == &Type_Action_Dispatcher) {
+        verb = VAL_WORD_SYM(ACT_BODY(act));
+        if (
+            verb != SYM_ADD and verb != SYM_SUBTRACT
+            and verb != SYM_MULTIPLY and verb != SYM_DIVIDE
+        ){
+            return FALSE;
+        }
+    }
+    else if (dispatcher == &N_equal_q)
+        strictness = 0;
+    else if (dispatcher == &N_not_equal_q) {
+        strictness = 0;
+        negate = TRUE;
+    }
+    else if (dispatcher == &N_strict_equal_q)
+        strictness = 1;
+    else if (dispatcher == &N_strict_not_equal_q) {
+        strictness = 1;
+        negate = TRUE;
+    }
+    else if (dispatcher == &N_lesser_q) {
+        strictness = -1;
+        negate = TRUE;
+    }
+    else if (dispatcher == &N_equal_or_lesser_q) {
+        strictness = -2;
+        negate = TRUE;
+    }
+    else if (dispatcher == &N_greater_q)
+        strictness = -2;
+    else if (dispatcher == &N_greater_or_equal_q)
+        strictness = -1;
+    else
+        return FALSE;
+
+    REBVAL *param1 = ACT_FACADE_HEAD(act);
+    REBVAL *param2 = param1 + 1;
+    enum Reb_Param_Class pclass = VAL_PARAM_CLASS(param2);
+    if (pclass != PARAM_CLASS_NORMAL and pclass != PARAM_CLASS_TIGHT)
+        return FALSE;
+
+    const RELVAL *right = f->source.pending; // f->value is the operator
+    if (IS_END(right) or GET_VAL_FLAG(right, VALUE_FLAG_EVAL_FLIP))
+        return FALSE;
+
+    const RELVAL *arg2;
+    if (IS_WORD(right)) {
+        arg2 = Get_Opt_Var_Else_End(right, f->specifier);
+        if (IS_END(arg2))
+            return FALSE;
+    }
+    else
+        arg2 = right;
+
+    enum Reb_Kind kind2 = VAL_TYPE(arg2);
+    if (kind2 != REB_INTEGER and kind2 != REB_DECIMAL)
+        return FALSE;
+
+    if (not TYPE_CHECK(param1, kind1) or not TYPE_CHECK(param2, kind2))
+        return FALSE;
+
+    // Arrays are terminated, so the cell after a non-END cell can be read.
+    //
+    const RELVAL *after = right + 1;
+    const REBVAL *after_gotten = END;
+    if (NOT_END(after)) {
+        if (IS_BAR(after) or GET_VAL_FLAG(after, VALUE_FLAG_EVAL_FLIP))
+            return FALSE;
+
+        if (IS_WORD(after)) {
+            if (pclass != PARAM_CLASS_TIGHT)
+                return FALSE; // e.g. `x < y + 1` would take `y + 1`
+
+            after_gotten = Get_Opt_Var_Else_End(after, f->specifier);
+            if (
+                VAL_TYPE_OR_0(after_gotten) == REB_ACTION // END is REB_0
+                and ANY_VAL_FLAGS(
+                    after_gotten,
+                    ACTION_FLAG_INVISIBLE | ACTION_FLAG_QUOTES_FIRST_ARG
+                )
+            ){
+                return FALSE;
+            }
+        }
+    }
+
+    if (verb == SYM_0) {
+        DECLARE_LOCAL (value1);
+        DECLARE_LOCAL (value2);
+        Move_Value(value1, f->out);
+        Move_Value(value2, const_KNOWN(arg2));
+        REBOOL result = did Compare_Modify_Values(value1, value2, strictness);
+        Init_Logic(f->out, negate ? not result : result);
+    }
+    else if (kind1 == REB_INTEGER and kind2 == REB_INTEGER) {
+        REBI64 num = VAL_INT64(f->out);
+        REBI64 arg = VAL_INT64(arg2);
+        REBI64 n;
+        switch (verb) {
+        case SYM_ADD:
+            if (REB_I64_ADD_OF(num, arg, &n))
+                return FALSE;
+            Init_Integer(f->out, n);
+            break;
+
+        case SYM_SUBTRACT:
+            if (REB_I64_SUB_OF(num, arg, &n))
+                return FALSE;
+            Init_Integer(f->out, n);
+            break;
+
+        case SYM_MULTIPLY:
+            if (REB_I64_MUL_OF(num, arg, &n))
+                return FALSE;
+            Init_Integer(f->out, n);
+            break;
+
+        default:
+            assert(verb == SYM_DIVIDE);
+            if (arg == 0 or (num == INT64_MIN and arg == -1))
+                return FALSE;
+            if (num % arg == 0)
+                Init_Integer(f->out, num / arg);
+            else
+                Init_Decimal(f->out, cast(REBDEC, num) / cast(REBDEC, arg));
+            break;
+        }
+    }
+    else {
+        REBDEC d1 = (kind1 == REB_INTEGER)
+            ? cast(REBDEC, VAL_INT64(f->out))
+            : VAL_DECIMAL(f->out);
+        REBDEC d2 = (kind2 == REB_INTEGER)
+            ? cast(REBDEC, VAL_INT64(arg2))
+            : VAL_DECIMAL(arg2);
+
+        switch (verb) {
+        case SYM_ADD:
+            d1 += d2;
+            break;
+
+        case SYM_SUBTRACT:
+            d1 -= d2;
+            break;
+
+        case SYM_MULTIPLY:
+            d1 *= d2;
+            break;
+
+        default:
+            assert(verb == SYM_DIVIDE);
+            if (d2 == 0.0)
+                return FALSE;
+            d1 /= d2;
+            break;
+        }
+
+        if (not FINITE(d1))
+            return FALSE;
+        Init_Decimal(f->out, d1);
+    }
+
+    Fetch_Next_In_Frame(f); // the operator
+    Fetch_Next_In_Frame(f); // its right hand argument
+    f->gotten = after_gotten; // lookup of f->value if it's a WORD!, or END
+    return TRUE;
+}
+
+
+//
+// Tail calls have to scan through their arguments for values bound into
+// the frames they would drop.  That can't be allowed to cost more than the
+// call itself would, so after this many cells the scan gives up.
+//
+#define TAIL_CALL_SCAN_LIMIT 256
+
+
+//
+// Could `v`, or anything it references, be bound into one of the frames from
+// `from` down to `stop`?  Answers TRUE if it can't tell within `budget`.
+//
+static REBOOL Binds_Into_Frames(
+    const RELVAL *v,
+    REBFRM *from,
+    REBFRM *stop,
+    REBCNT *budget
+){
+    if (*budget == 0)
+        return TRUE;
+    --(*budget);
+
+    REBNOD *binding = Is_Bindable(v) ? v->extra.binding : UNBOUND;
+    REBARR *varlist = ANY_CONTEXT(v) ? CTX_VARLIST(VAL_CONTEXT(v)) : NULL;
+
+    REBFRM *dropping = from;
+    for (; dropping != stop->prior; dropping = dropping->prior) {
+        if (not Is_Action_Frame(dropping) or dropping->varlist == NULL)
+            continue;
+        if (binding == NOD(dropping->varlist) or varlist == dropping->varlist)
+            return TRUE;
+    }
+
+    if (ANY_ARRAY(v)) {
+        RELVAL *item = ARR_HEAD(VAL_ARRAY(v));
+        for (; NOT_END(item); ++item) {
+            if (Binds_Into_Frames(item, from, stop, budget))
+                return TRUE;
+        }
+        return FALSE;
+    }
+
+    if (varlist != NULL) {
+        if (GET_SER_INFO(varlist, SERIES_INFO_INACCESSIBLE))
+            return FALSE; // an expired frame, nothing left to bind
+        if (GET_SER_FLAG(varlist, CONTEXT_FLAG_STACK))
+            return TRUE; // the frame of a live call...don't bother looking
+
+        REBVAL *var = CTX_VARS_HEAD(VAL_CONTEXT(v));
+        for (; NOT_END(var); ++var) {
+            if (Binds_Into_Frames(var, from, stop, budget))
+                return TRUE;
+        }
+        return FALSE;
+    }
+
+    if (IS_MAP(v)) {
+        RELVAL *item = ARR_HEAD(MAP_PAIRLIST(VAL_MAP(v)));
+        for (; NOT_END(item); ++item) {
+            if (Binds_Into_Frames(item, from, stop, budget))
+                return TRUE;
+        }
+        return FALSE;
+    }
+
+    if (IS_ACTION(v)) {
+        // e.g. a FUNC made in the frame has words in its body bound there
+        //
+        if (Binds_Into_Frames(VAL_ACT_BODY(v), from, stop, budget))
+            return TRUE;
+
+        REBCTX *exemplar = ACT_EXEMPLAR(VAL_ACTION(v));
+        if (exemplar != NULL) {
+            REBVAL *var = CTX_VARS_HEAD(exemplar);
+            for (; NOT_END(var); ++var) {
+                if (Binds_Into_Frames(var, from, stop, budget))
+                    return TRUE;
+            }
+        }
+        return FALSE;
+    }
+
+    return FALSE;
+}
+
+
+//
+//  Branch_Native_Frame: C
+//
+// If `f` is running the block branch of an IF, IF-NOT or EITHER, get the
+// frame of that native (which returns what the branch does), else NULL.
+// Sets `blankify` if the native turns a null result into BLANK!, as it does
+// without /OPT (see Run_Branch_Throws()).
+//
+static REBFRM *Branch_Native_Frame(REBFRM *f, REBOOL *blankify)
+{
+    REBFRM *native = f->prior;
+    if (
+        native == NULL
+        or not Is_Action_Frame(native)
+        or Is_Action_Frame_Fulfilling(native)
+        or native->out != f->out
+    ){
+        return NULL;
+    }
+
+    REBCNT opt; // number of the /OPT refinement's arg
+    if (
+        native->phase == NAT_ACTION(if)
+        or native->phase == NAT_ACTION(if_not)
+    ){
+        REBVAL *branch = FRM_ARG(native, 2);
+        if (not IS_BLOCK(branch) or VAL_ARRAY(branch) != f->source.array)
+            return NULL;
+        opt = 3;
+    }
+    else if (native->phase == NAT_ACTION(either)) {
+        REBVAL *true_branch = FRM_ARG(native, 2);
+        REBVAL *false_branch = FRM_ARG(native, 3);
+        if (
+            not (
+                IS_BLOCK(true_branch)
+                and VAL_ARRAY(true_branch) == f->source.array
+            )
+            and not (
+                IS_BLOCK(false_branch)
+                and VAL_ARRAY(false_branch) == f->source.array
+            )
+        ){
+            return NULL;
+        }
+        opt = 4;
+    }
+    else
+        return NULL;
+
+    if (IS_FALSEY(FRM_ARG(native, opt)))
+        *blankify = TRUE;
+    return native;
+}
+
+
+//
+// A call is in "tail position" if what it returns is what an action further
+// down the stack is going to return, with nothing left to do in between.
+// Recursing through such calls doesn't need a new REBFRM (and C stack) for
+// each level: the frame that will get the result can drop its action and
+// run the call itself.  This is how REDO works, so it's done by throwing
+// a REDO to that frame, and Do_Core() catches it there.
+//
+// Two tail positions are noticed for interpreted actions: the last thing
+// in a body, or in a block branch of an IF, IF-NOT or EITHER that is itself
+// in tail position, and the argument to a RETURN run directly in a body.
+// (A RETURN inside of another block could be under a CATCH that would get
+// the REDO, so it's not counted.)  Whatever return type check the target
+// would make on the result must also be made by the call, else it's run
+// normally.  Branches that turn null into BLANK! get the frame to do that
+// to its final result instead (DO_FLAG_TAIL_BLANKIFY).
+//
+// Calls at the end of other branches (like CASE or SWITCH) or of a block
+// run by DO are not tail calls.  Tracing and METRICS see every call, so they turn this
+// off by hooking PG_Do or PG_Apply.  PROFILE and SAMPLE-ALLOCATIONS record
+// the stack of actions, so no tail calls are made while they're on either.
+//
+// Otherwise, the actions whose frames were dropped are missing from the
+// stack: a backtrace only shows `...` where they were (see c-error.c).
+//
+// Called with `f` fulfilled and about to dispatch.  Returns TRUE if it has
+// put the thrown tail call in f->out instead.
+//
+static REBOOL Tail_Call_Throws(REBFRM *f)
+{
+    REBNAT dispatcher = ACT_DISPATCHER(f->phase);
+    REBU64 result_types;
+    if (dispatcher == &Returner_Dispatcher) {
+        REBVAL *typeset = ACT_PARAM(f->phase, ACT_NUM_PARAMS(f->phase));
+        result_types = VAL_TYPESET_BITS(typeset);
+    }
+    else if (dispatcher == &Unchecked_Dispatcher)
+        result_types = ~cast(REBU64, 0);
+    else if (dispatcher == &Voider_Dispatcher)
+        result_types = FLAGIT_KIND(REB_MAX_VOID);
+    else
+        return FALSE; // natives don't recurse through the evaluator
+
+    if (PG_Do != &Do_Core or PG_Apply != &Apply_Core)
+        return FALSE;
+
+    if (TG_Profiling or TG_Sample_Every != 0)
+        return FALSE;
+
+    REBFRM *target;
+    REBACT *checker; // action whose RETURN: types the result must match
+    REBOOL blankify = FALSE;
+
+    if (f->flags.bits & DO_FLAG_TO_END) {
+        if (FRM_HAS_MORE(f))
+            return FALSE;
+
+        REBFRM *body = f; // frame running the target's body
+        REBFRM *native;
+        while ((native = Branch_Native_Frame(body, &blankify)) != NULL) {
+            if (not (native->flags.bits & DO_FLAG_TO_END))
+                return FALSE;
+            if (FRM_HAS_MORE(native))
+                return FALSE;
+            body = native;
+        }
+
+        target = body->prior;
+        if (
+            target == NULL
+            or not Is_Action_Frame(target)
+            or Is_Action_Frame_Fulfilling(target)
+            or target->out != body->out
+        ){
+            return FALSE;
+        }
+
+        if (ACT_DISPATCHER(target->phase) == &Returner_Dispatcher)
+            checker = target->phase;
+        else if (ACT_DISPATCHER(target->phase) == &Unchecked_Dispatcher)
+            checker = NULL;
+        else
+            return FALSE; // e.g. Voider_Dispatcher changes the result
+
+        if (
+            body->source.array != VAL_ARRAY(ACT_BODY(target->phase))
+            or body->specifier != SPC(target)
+        ){
+            return FALSE; // not the body of the action, e.g. a DO in it
+        }
+    }
+    else if (f->flags.bits & DO_FLAG_FULFILLING_ARG) {
+        if (FRM_HAS_MORE(f) and IS_WORD(f->value))
+            return FALSE; // may be enfix, taking the call as its left side
+
+        REBFRM *ret = f->prior;
+        if (not Is_Action_Frame(ret) or ret->phase != NAT_ACTION(return))
+            return FALSE;
+
+        if (IS_CELL(ret->binding))
+            target = cast(REBFRM*, ret->binding);
+        else if (ret->binding->header.bits & ARRAY_FLAG_VARLIST) {
+            target = CTX_FRAME_IF_ON_STACK(CTX(ret->binding));
+            if (target == NULL)
+                return FALSE; // let RETURN report the error
+        }
+        else
+            return FALSE; // unbound RETURN archetype
+
+        if (Is_Action_Frame_Fulfilling(target))
+            return FALSE;
+
+        // Frames between the RETURN and its action could catch the REDO
+        // (e.g. `catch/any [return g n]`), so RETURN must be in the body.
+        //
+        if (
+            ret->prior != target
+            or not (ret->flags.bits & DO_FLAG_TO_END)
+            or ret->source.array != VAL_ARRAY(ACT_BODY(target->phase))
+            or ret->specifier != SPC(target)
+        ){
+            return FALSE;
+        }
+
+        if (
+            ACT_DISPATCHER(target->phase) != &Returner_Dispatcher
+            and ACT_DISPATCHER(target->phase) != &Unchecked_Dispatcher
+        ){
+            return FALSE;
+        }
+
+        checker = FRM_UNDERLYING(target); // see REBNATIVE(return)
+    }
+    else
+        return FALSE;
+
+    if (blankify and (result_types & FLAGIT_KIND(REB_MAX_VOID))) {
+        result_types &= ~FLAGIT_KIND(REB_MAX_VOID);
+        result_types |= FLAGIT_KIND(REB_BLANK);
+    }
+
+    if (checker != NULL) {
+        REBVAL *typeset = ACT_PARAM(checker, ACT_NUM_PARAMS(checker));
+        assert(VAL_PARAM_SYM(typeset) == SYM_RETURN);
+        if (result_types & ~VAL_TYPESET_BITS(typeset))
+            return FALSE;
+    }
+
+    if (DSP != target->dsp_orig)
+        return FALSE; // e.g. a CHAIN has actions pending on the result
+
+    // The frames from the target up are dropped before the call runs, so
+    // the call can't be given anything bound into them, like a block from
+    // the body or a FRAME!.  (Stack bindings that aren't reified might be
+    // to any frame, so they're not tail called either.)  Only a reified
+    // frame can have bindings to it in other cells, but those may be nested
+    // anywhere in the arguments, e.g. `helper reduce ['print 'x]`...or in
+    // the action itself, e.g. `inner: func [] [x]` made in the body.
+    //
+    REBOOL reified = FALSE;
+    REBFRM *dropping = f->prior;
+    for (; dropping != target->prior; dropping = dropping->prior) {
+        if (Is_Action_Frame(dropping) and dropping->varlist != NULL)
+            reified = TRUE;
+    }
+
+    REBCNT budget = TAIL_CALL_SCAN_LIMIT;
+
+    if (IS_CELL(f->binding))
+        return FALSE;
+
+    if (reified) {
+        DECLARE_LOCAL (callee);
+        Move_Value(callee, ACT_ARCHETYPE(f->phase));
+        INIT_BINDING(callee, f->binding);
+        if (Binds_Into_Frames(callee, f->prior, target, &budget))
+            return FALSE;
+    }
+
+    REBVAL *param = ACT_FACADE_HEAD(f->phase);
+    REBVAL *arg = f->args_head;
+    for (; NOT_END(param); ++param, ++arg) {
+        if (
+            VAL_PARAM_CLASS(param) == PARAM_CLASS_LOCAL
+            or VAL_PARAM_CLASS(param) == PARAM_CLASS_RETURN
+            or VAL_PARAM_CLASS(param) == PARAM_CLASS_LEAVE
+            or not Is_Bindable(arg)
+        ){
+            continue;
+        }
+
+        if (IS_CELL(arg->extra.binding))
+            return FALSE;
+
+        if (reified and Binds_Into_Frames(arg, f->prior, target, &budget))
+            return FALSE;
+    }
+
+    // The arguments are on the chunk stack above the target's, and will be
+    // dropped on the way down, so they're copied to an array along with the
+    // label, the action, and whether to blankify.  Locals and RETURN are
+    // refilled when checked.
+    //
+    REBCNT num_args = ACT_FACADE_NUM_PARAMS(f->phase);
+    REBARR *a = Make_Array(num_args + 3);
+    RELVAL *dest = ARR_HEAD(a);
+
+    if (f->opt_label != NULL)
+        Init_Word(dest, f->opt_label);
+    else
+        Init_Blank(dest);
+    ++dest;
+
+    Move_Value(dest, ACT_ARCHETYPE(f->phase));
+    INIT_BINDING(dest, f->binding);
+    ++dest;
+
+    Init_Logic(dest, blankify);
+    ++dest;
+
+    param = ACT_FACADE_HEAD(f->phase);
+    arg = f->args_head;
+    for (; NOT_END(param); ++param, ++arg, ++dest) {
+        switch (VAL_PARAM_CLASS(param)) {
+        case PARAM_CLASS_LOCAL:
+        case PARAM_CLASS_RETURN:
+        case PARAM_CLASS_LEAVE:
+            Init_Void(dest);
+            break;
+
+        default:
+            Move_Value(dest, arg);
+        }
+    }
+    TERM_ARRAY_LEN(a, num_args + 3);
+    MANAGE_ARRAY(a);
+
+    DECLARE_LOCAL (call);
+    Init_Block(call, a);
+
+    Move_Value(f->out, NAT_VALUE(redo));
+    f->out->extra.binding = NOD(target); // as with RETURN, don't reify
+    CONVERT_NAME_TO_THROWN(f->out, call);
+    return TRUE;
+}
+
+
 //
 //  Do_Core: C
 //
@@ -1248,6 +1847,9 @@ reevaluate:;
 
                 Prep_Stack_Cell(f->arg);
 
+                if (evaluating and Do_Next_In_Subframe_Quickly(f->arg, f))
+                    break;
+
                 DECLARE_FRAME (child); // capture DSP *now*
                 if (Do_Next_In_Subframe_Throws(f->arg, f, flags, child)) {
                     Move_Value(f->out, f->arg);
@@ -1269,6 +1871,9 @@ reevaluate:;
 
                 Prep_Stack_Cell(f->arg);
 
+                if (evaluating and Do_Next_In_Subframe_Quickly(f->arg, f))
+                    break;
+
                 DECLARE_FRAME (child);
                 if (Do_Next_In_Subframe_Throws(f->arg, f, flags, child)) {
                     Move_Value(f->out, f->arg);
@@ -1446,6 +2051,9 @@ reevaluate:;
         //
         f->gotten = END;
 
+        if (Tail_Call_Throws(f))
+            goto abort_action; // caught as a REDO by the frame that runs it
+
         // Cases should be in enum order for jump-table optimization
         // (R_FALSE first, R_TRUE second, etc.)
         //
@@ -1505,6 +2113,46 @@ reevaluate:;
                     // the phase and binding we are to resume with.
                     //
                     CATCH_THROWN(f->out, f->out);
+
+                    if (IS_BLOCK(f->out)) {
+                        //
+                        // A tail call (see Tail_Call_Throws()).  The block
+                        // is the label, the action, whether to blankify,
+                        // and its fulfilled args.  Switch this frame over
+                        // to the action and check the args as REDO would.
+                        //
+                        RELVAL *item = VAL_ARRAY_HEAD(f->out);
+                        REBSTR *opt_label = IS_WORD(item)
+                            ? VAL_WORD_SPELLING(item)
+                            : NULL;
+                        ++item;
+
+                        RELVAL *action = item;
+                        ++item;
+
+                        REBFLGS blankify = VAL_LOGIC(item)
+                            ? DO_FLAG_TAIL_BLANKIFY
+                            : f->flags.bits & DO_FLAG_TAIL_BLANKIFY;
+                        ++item;
+
+                        Drop_Action_Core(f, true); // drop_chunks = true
+                        Push_Action(
+                            f,
+                            opt_label,
+                            VAL_ACTION(action),
+                            VAL_BINDING(action)
+                        );
+                        TRASH_POINTER_IF_DEBUG(f->deferred);
+                        f->flags.bits |= DO_FLAG_TAIL_CALLED | blankify;
+
+                        REBVAL *arg = f->args_head;
+                        for (; NOT_END(item); ++item, ++arg) {
+                            Prep_Stack_Cell(arg);
+                            Move_Value(arg, KNOWN(item));
+                        }
+                        goto redo_checked;
+                    }
+
                     assert(IS_FRAME(f->out));
 
                     // !!! We are reusing the frame and may be jumping to an
@@ -1716,6 +2364,11 @@ reevaluate:;
         // this frame that could be even more optimal.  However, having the
         // original function still on the stack helps make errors clearer.
         //
+        if (f->flags.bits & DO_FLAG_TAIL_BLANKIFY) {
+            if (IS_VOID(f->out))
+                Init_Blank(f->out); // as the branch of a tail call would
+        }
+
         Drop_Action_Core(f, true); // drop_chunks = true
         break;
 
@@ -2553,6 +3206,12 @@ post_switch:;
     // requested in the context of parameter fulfillment.  We want to reuse
     // the f->out value and get it into the new function's frame.
 
+    if (evaluating and Do_Quick_Math_Maybe(f)) {
+        if (FRM_AT_END(f))
+            goto finished; // post_switch needs an f->value to look at
+        goto post_switch; // e.g. `i + 1 * 2` can still have enfix to run
+    }
+
     Push_Action(
         f,
         VAL_WORD_SPELLING(f->value),
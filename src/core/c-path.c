@@ -91,6 +91,13 @@ REBOOL Next_Path_Throws(REBPVS *pvs)
     //
     assert(pvs->refine == &pvs->cell);
 
+    // The path cell a WORD! picker came from is where dispatchers can cache
+    // what the pick found, for the next time that path runs (see notes on
+    // `param` in REBFRM).  Pickers that are fetched or evaluated vary, so
+    // they get no cache.
+    //
+    pvs->param = NULL;
+
     if (IS_GET_WORD(pvs->value)) { // e.g. object/:field
         Move_Opt_Var_May_Fail(
             SINK(&pvs->cell), pvs->value, pvs->specifier
@@ -113,6 +120,8 @@ REBOOL Next_Path_Throws(REBPVS *pvs)
     }
     else { // object/word and object/value case:
         Derelativize(&pvs->cell, pvs->value, pvs->specifier);
+        if (IS_WORD(pvs->value))
+            pvs->param = pvs->value;
     }
 
     // Disallow voids from being used in path dispatch.  This rule seems like
@@ -589,6 +598,7 @@ REBNATIVE(pick)
     pvs->value = D_CELL;
     pvs->specifier = SPECIFIED;
 
+    pvs->param = NULL; // picker isn't in a path, so nowhere to cache picks
     pvs->opt_label = NULL; // applies to e.g. :append/only returning APPEND
     pvs->special = NULL;
 
@@ -666,6 +676,7 @@ REBNATIVE(poke)
     pvs->value = D_CELL;
     pvs->specifier = SPECIFIED;
 
+    pvs->param = NULL; // picker isn't in a path, so nowhere to cache picks
     pvs->opt_label = NULL; // applies to e.g. :append/only returning APPEND
     pvs->special = ARG(value);
 
@@ -108,7 +108,18 @@ REBOOL Do_Signals_Throws(REBVAL *out)
 
     if (filtered_sigs & SIG_RECYCLE) {
         CLR_SIGNAL(SIG_RECYCLE);
-        Recycle();
+        Recycle_Auto();
+    }
+
+  #ifndef HAS_POSIX_SIGNAL
+    if (TG_Profiling) // no timer, so sample each time the Eval_Dose runs out
+        filtered_sigs |= SIG_PROFILE;
+  #endif
+
+    if (filtered_sigs & SIG_PROFILE) {
+        CLR_SIGNAL(SIG_PROFILE);
+        if (TG_Profiling) // (a last tick may come after PROFILE/STOP)
+            Sample_Profile();
     }
 
 #ifdef NOT_USED_INVESTIGATE
@@ -157,14 +157,14 @@ static void Expand_Word_Table(void)
             continue;
         }
 
-        REBINT hash = Hash_String(canon);
-        REBINT skip = (hash & 0x0000FFFF) % new_size;
+        REBCNT hash = Hash_String(canon);
+        REBCNT skip = (hash >> 16) % new_size;
         if (skip == 0) skip = 1;
-        hash = (hash & 0x00FFFF00) % new_size;
+        hash = hash % new_size;
 
         while (new_canons_by_hash[hash] != NULL) {
             hash += skip;
-            if (hash >= cast(REBINT, new_size))
+            if (hash >= new_size)
                 hash -= new_size;
         }
         new_canons_by_hash[hash] = canon;
@@ -213,10 +213,10 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     // each time a slot is found that is occupied by a non-match.
     //
     REBCNT hash = Hash_UTF8(utf8, size);
-    REBCNT skip = (hash & 0x0000FFFF) % num_slots;
+    REBCNT skip = (hash >> 16) % num_slots;
     if (skip == 0)
         skip = 1;
-    hash = (hash & 0x00FFFF00) % num_slots;
+    hash = hash % num_slots;
 
     REBSTR **deleted_slot = NULL;
 
@@ -412,10 +412,10 @@ void GC_Kill_Interning(REBSTR *intern)
     REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
 
     REBCNT hash = Hash_String(intern);
-    REBCNT skip = (hash & 0x0000FFFF) % num_slots;
+    REBCNT skip = (hash >> 16) % num_slots;
     if (skip == 0)
         skip = 1;
-    hash = (hash & 0x00FFFF00) % num_slots;
+    hash = hash % num_slots;
 
     // We *will* find the canon form in the hash table.
     //
@@ -466,6 +466,45 @@ void GC_Kill_Interning(REBSTR *intern)
 }
 
 
+//
+//  Sweep_Dead_Interns: C
+//
+// The interned strings are held weakly by PG_Canons_By_Hash, so they are
+// the one way that the program could get at a dead series whose segment has
+// not been swept yet.  Before the GC defers a sweep, it frees them with this.
+// (The dead are gathered first, as freeing a canon may move hash entries.)
+//
+REBCNT Sweep_Dead_Interns(void)
+{
+    REBSER *dead = Make_Series(64, sizeof(REBSTR*));
+
+    REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
+    REBCNT n;
+    for (n = 0; n < SER_LEN(PG_Canons_By_Hash); ++n) {
+        REBSTR *canon = canons_by_hash[n];
+        if (canon == NULL or canon == DELETED_CANON)
+            continue;
+
+        REBSTR *intern = canon;
+        do {
+            assert(IS_SERIES_MANAGED(intern));
+            if (not (intern->header.bits & NODE_FLAG_MARKED)) {
+                EXPAND_SERIES_TAIL(dead, 1);
+                *SER_LAST(REBSTR*, dead) = intern;
+            }
+            intern = LINK(intern).synonym;
+        } while (intern != canon);
+    }
+
+    REBCNT count = SER_LEN(dead);
+    for (n = 0; n < count; ++n)
+        GC_Kill_Series(*SER_AT(REBSTR*, dead, n));
+
+    Free_Series(dead);
+    return count;
+}
+
+
 //
 //  Compare_Word: C
 //
@@ -34,6 +34,13 @@
 
 #include "sys-core.h"
 
+#include <time.h> // clock(), for the CPU times of METRICS
+
+#ifdef HAS_POSIX_SIGNAL
+    #include <sys/signal.h>
+    #include <sys/time.h> // setitimer()
+#endif
+
 
 //
 //  stats: native [
@@ -48,6 +55,8 @@
 //          "High resolution time difference from start"
 //      /evals
 //          "Number of values evaluated by interpreter"
+//      /gc
+//          "Garbage collector statistics object"
 //      /dump-series
 //          "Dump all series in pool"
 //      pool-id [integer!]
@@ -70,6 +79,45 @@ REBNATIVE(stats)
         return R_OUT;
     }
 
+    if (REF(gc)) {
+        REBCTX *gc = Copy_Context_Shallow(
+            VAL_CONTEXT(Get_System(SYS_STANDARD, STD_GC_STATS))
+        );
+
+        Init_Integer(CTX_VAR(gc, STD_GC_STATS_RECYCLES), GC_Recycles);
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_GC_STATS_PAUSE_TIME), GC_Pause_Time * 1000
+        );
+        Init_Integer(CTX_VAR(gc, STD_GC_STATS_RELEASED), PG_Mem_Released);
+        Init_Integer(CTX_VAR(gc, STD_GC_STATS_LIVE), GC_Live_Bytes);
+        Init_Integer(CTX_VAR(gc, STD_GC_STATS_BALLAST), TG_Ballast);
+
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_GC_STATS_ROOT_TIME), GC_Root_Time * 1000
+        );
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_GC_STATS_STACK_TIME), GC_Stack_Time * 1000
+        );
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_GC_STATS_PROPAGATE_TIME), GC_Propagate_Time * 1000
+        );
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_GC_STATS_SWEEP_TIME), GC_Sweep_Time * 1000
+        );
+        Init_Integer(CTX_VAR(gc, STD_GC_STATS_FREED), GC_Nodes_Freed);
+        Init_Integer(CTX_VAR(gc, STD_GC_STATS_RECLAIMED), GC_Bytes_Freed);
+
+        REBARR *pauses = Make_Array(GC_PAUSE_BUCKETS);
+        REBCNT n;
+        for (n = 0; n < GC_PAUSE_BUCKETS; ++n)
+            Init_Integer(ARR_AT(pauses, n), GC_Pauses[n]);
+        TERM_ARRAY_LEN(pauses, GC_PAUSE_BUCKETS);
+        Init_Block(CTX_VAR(gc, STD_GC_STATS_PAUSES), pauses);
+
+        Init_Object(D_OUT, gc);
+        return R_OUT;
+    }
+
 #ifdef NDEBUG
     UNUSED(REF(show));
     UNUSED(REF(profile));
@@ -171,14 +219,140 @@ enum {
     //
     IDX_STATS_NUMCALLS = 1,
 
-    // !!! More will be added here when timing data is included, but timing
-    // is tricky to do meaningfully while subtracting the instrumentation
-    // itself out.
+    // TIME! from the first phase of a call starting to the last one ending,
+    // including the time spent in the functions it called.  Recursions are
+    // not counted twice: only the outermost call to a function adds to it.
+    //
+    IDX_STATS_INCLUSIVE = 2,
+
+    // TIME! spent in the function itself, not in measured functions it
+    // called (so it adds up to the time spent with metrics on).
+    //
+    IDX_STATS_EXCLUSIVE = 3,
+
+    // Processor time as reported by clock(), split the same way.  This is
+    // lower than the wall clock time when waiting on I/O or other processes.
+    //
+    IDX_STATS_CPU_INCLUSIVE = 4,
+    IDX_STATS_CPU_EXCLUSIVE = 5,
 
     IDX_STATS_MAX
 };
 
 
+// A call being measured has an entry in TG_Metrics_Calls, pushed when its
+// first phase starts and dropped when its last phase ends.  A call which is
+// abandoned by a fail() never sees its last phase, so its entry is dropped
+// the next time an entry is pushed by a frame it isn't an ancestor of (or
+// when one of its ancestors ends).
+//
+struct Reb_Metric_Call {
+    REBFRM *frame;
+    REBACT *action; // f->original, only compared to detect recursions
+    REBI64 wall; // OS_DELTA_TIME(0) microseconds when the call started
+    REBI64 cpu; // clock() ticks when the call started
+    REBI64 child_wall; // microseconds spent in measured calls made by it
+    REBI64 child_cpu; // clock() ticks spent in measured calls made by it
+};
+
+#define CLOCK_TO_NANOS(ticks) \
+    ((ticks) * (1000000000 / CLOCKS_PER_SEC))
+
+
+//
+//  Is_Frame_Running: C
+//
+static REBOOL Is_Frame_Running(REBFRM *frame, REBFRM *f)
+{
+    for (; f != NULL; f = f->prior) {
+        if (f == frame)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+
+//
+//  Push_Metric_Call: C
+//
+static void Push_Metric_Call(REBFRM *f)
+{
+    REBSER *calls = TG_Metrics_Calls;
+    while (SER_LEN(calls) != 0) {
+        REBFRM *frame = SER_LAST(struct Reb_Metric_Call, calls)->frame;
+        if (Is_Frame_Running(frame, f->prior))
+            break;
+        SET_SERIES_LEN(calls, SER_LEN(calls) - 1); // abandoned call
+    }
+
+    EXPAND_SERIES_TAIL(calls, 1);
+
+    struct Reb_Metric_Call *call = SER_LAST(struct Reb_Metric_Call, calls);
+    call->frame = f;
+    call->action = f->original;
+    call->wall = OS_DELTA_TIME(0);
+    call->cpu = cast(REBI64, clock());
+    call->child_wall = 0;
+    call->child_cpu = 0;
+}
+
+
+//
+//  Pop_Metric_Call: C
+//
+// Drops the entry for the frame (and any abandoned ones above it), giving
+// back the times for the call in nanoseconds.  Returns FALSE if there was no
+// entry, e.g. because metrics were turned on while the call was running.
+//
+static REBOOL Pop_Metric_Call(
+    REBI64 *inclusive,
+    REBI64 *exclusive,
+    REBI64 *cpu_inclusive,
+    REBI64 *cpu_exclusive,
+    REBOOL *recursion,
+    REBFRM *f
+){
+    REBSER *calls = TG_Metrics_Calls;
+    struct Reb_Metric_Call *head = SER_HEAD(struct Reb_Metric_Call, calls);
+
+    REBCNT n = SER_LEN(calls);
+    while (TRUE) {
+        if (n == 0)
+            return FALSE;
+        --n;
+        if (head[n].frame == f and head[n].action == f->original)
+            break;
+    }
+
+    struct Reb_Metric_Call *call = &head[n];
+
+    REBI64 wall = OS_DELTA_TIME(call->wall);
+    REBI64 cpu = cast(REBI64, clock()) - call->cpu;
+
+    *inclusive = wall * 1000;
+    *exclusive = (wall - call->child_wall) * 1000;
+    *cpu_inclusive = CLOCK_TO_NANOS(cpu);
+    *cpu_exclusive = CLOCK_TO_NANOS(cpu - call->child_cpu);
+
+    *recursion = FALSE;
+    REBCNT i;
+    for (i = 0; i < n; ++i) {
+        if (head[i].action == call->action) {
+            *recursion = TRUE;
+            break;
+        }
+    }
+
+    if (n != 0) {
+        head[n - 1].child_wall += wall;
+        head[n - 1].child_cpu += cpu;
+    }
+
+    SET_SERIES_LEN(calls, n);
+    return TRUE;
+}
+
+
 //
 //  Apply_Core_Measured: C
 //
@@ -186,7 +360,8 @@ enum {
 // enabled.
 //
 // In order to actually be accurate, it would need some way to subtract out
-// its own effect on the timing of functions above on the stack.
+// its own effect on the timing of functions above on the stack.  As it is,
+// the bookkeeping for a call is charged to the exclusive time of its caller.
 //
 REB_R Apply_Core_Measured(REBFRM * const f)
 {
@@ -206,19 +381,36 @@ REB_R Apply_Core_Measured(REBFRM * const f)
         // would require restructuring the evaluator in a way that would
         // compromise its efficiency.  But as a result, if we want to store
         // the accumulated time for this function run we need to have a map
-        // from frame to start time.
+        // from frame to start time...which is what TG_Metrics_Calls is.
         //
-        // This is where we would be starting a timer.  A simpler case is
-        // being studied for starters...of just counting.
+        Push_Metric_Call(f);
     }
 
     REB_R r = Apply_Core(f);
 
     if (is_last_phase) {
         //
-        // Finalize the inclusive time if it's the last phase.  Timing info
-        // is being skipped for starters, just to increment a count of how
-        // many times the function gets called.
+        // Finalize the inclusive time if it's the last phase.
+
+        REBI64 inclusive = 0;
+        REBI64 exclusive = 0;
+        REBI64 cpu_inclusive = 0;
+        REBI64 cpu_exclusive = 0;
+        REBOOL recursion = FALSE;
+        if (not Pop_Metric_Call(
+            &inclusive,
+            &exclusive,
+            &cpu_inclusive,
+            &cpu_exclusive,
+            &recursion,
+            f
+        )){
+            recursion = TRUE; // no start time, so count the call only
+        }
+        if (recursion) {
+            inclusive = 0;
+            cpu_inclusive = 0;
+        }
 
         const REBOOL cased = FALSE;
         REBINT n = Find_Map_Entry(
@@ -240,6 +432,14 @@ REB_R Apply_Core_Measured(REBFRM * const f)
             else
                 Init_Blank(ARR_AT(a, IDX_STATS_SYMBOL));
             Init_Integer(ARR_AT(a, IDX_STATS_NUMCALLS), 1);
+            Init_Time_Nanoseconds(ARR_AT(a, IDX_STATS_INCLUSIVE), inclusive);
+            Init_Time_Nanoseconds(ARR_AT(a, IDX_STATS_EXCLUSIVE), exclusive);
+            Init_Time_Nanoseconds(
+                ARR_AT(a, IDX_STATS_CPU_INCLUSIVE), cpu_inclusive
+            );
+            Init_Time_Nanoseconds(
+                ARR_AT(a, IDX_STATS_CPU_EXCLUSIVE), cpu_exclusive
+            );
             TERM_ARRAY_LEN(a, IDX_STATS_MAX);
 
             DECLARE_LOCAL (stats);
@@ -268,6 +468,10 @@ REB_R Apply_Core_Measured(REBFRM * const f)
                     || IS_BLANK(ARR_AT(a, IDX_STATS_SYMBOL))
                 )
                 && IS_INTEGER(ARR_AT(a, IDX_STATS_NUMCALLS))
+                && IS_TIME(ARR_AT(a, IDX_STATS_INCLUSIVE))
+                && IS_TIME(ARR_AT(a, IDX_STATS_EXCLUSIVE))
+                && IS_TIME(ARR_AT(a, IDX_STATS_CPU_INCLUSIVE))
+                && IS_TIME(ARR_AT(a, IDX_STATS_CPU_EXCLUSIVE))
             ){
                 if (
                     IS_BLANK(ARR_AT(a, IDX_STATS_SYMBOL))
@@ -279,6 +483,10 @@ REB_R Apply_Core_Measured(REBFRM * const f)
                     ARR_AT(a, IDX_STATS_NUMCALLS),
                     VAL_INT64(ARR_AT(a, IDX_STATS_NUMCALLS)) + 1
                 );
+                VAL_NANO(ARR_AT(a, IDX_STATS_INCLUSIVE)) += inclusive;
+                VAL_NANO(ARR_AT(a, IDX_STATS_EXCLUSIVE)) += exclusive;
+                VAL_NANO(ARR_AT(a, IDX_STATS_CPU_INCLUSIVE)) += cpu_inclusive;
+                VAL_NANO(ARR_AT(a, IDX_STATS_CPU_EXCLUSIVE)) += cpu_exclusive;
             }
             else if (not IS_ERROR(stats)) {
                 //
@@ -379,11 +587,18 @@ REB_R Apply_Core_Measured(REBFRM * const f)
 //  {Track function calls and inclusive timings for those calls.}
 //
 //      return: [map!]
+//          {ACTION! => [name calls inclusive exclusive cpu-in cpu-ex]}
 //      mode [logic!]
 //          {Whether metrics should be on or off.}
+//      /reset
+//          {Forget the counts and times gathered so far.}
 //  ]
 //
 REBNATIVE(metrics)
+//
+// The times are TIME! values, with "inclusive" counting the functions that
+// a function calls and "exclusive" only counting the function itself.  The
+// CPU times are the processor time spent by the interpreter.
 {
     INCLUDE_PARAMS_OF_METRICS;
 
@@ -391,8 +606,18 @@ REBNATIVE(metrics)
 
     Check_Security(Canon(SYM_DEBUG), POL_READ, 0);
 
+    if (REF(reset)) {
+        //
+        // A map that has already been handed out stays as it was, so a
+        // snapshot can be kept while gathering another.
+        //
+        Init_Map(Root_Stats_Map, Make_Map(10));
+    }
+
     if (VAL_LOGIC(mode)) {
         //PG_Do = &Do_Core_Measured;
+        if (PG_Apply != &Apply_Core_Measured)
+            SET_SERIES_LEN(TG_Metrics_Calls, 0); // stale if it was off
         PG_Apply = &Apply_Core_Measured;
     }
     else {
@@ -451,3 +676,938 @@ REBNATIVE(callgrind)
     fail ("This exeuctable wasn't compiled with INCLUDE_CALLGRIND_NATIVE");
 #endif
 }
+
+
+//=//// ALLOCATION PROFILER ///////////////////////////////////////////////=//
+//
+// When memory balloons, it helps to know what code is making the series.
+// Looking at every allocation would be too slow, so once the profiler is
+// started with SAMPLE-ALLOCATIONS/EVERY it picks one allocation each time
+// that many more bytes have been allocated.  A sample stands for all of the
+// bytes since the last one, and is tallied by its "call site": the width of
+// the series and the label, file, and line of the innermost few actions on
+// the stack.  When the profiler is off, the only cost is a test of
+// TG_Sample_Every in Make_Series_Core() and Expand_Series().
+//
+// Sampled series get SERIES_INFO_SAMPLED, and are put in TG_Alloc_Samples so
+// that GC_Kill_Series() can take them off the "live" tally of their site.
+// That is a hash table keyed by the series pointer (open addressing, with
+// linear probing), so a big heap of samples doesn't make each free slow.
+// It's in plain memory, not a series, so it can't be seen by the GC.
+//
+// The tallies are kept in a BLOCK! with a fixed-size group of cells for each
+// site, so they can be updated without making new series.  (Allocations may
+// be sampled in places where making a managed series would not be safe.)
+// Sites are found by a hash of their width and frames, in TG_Alloc_Site_Slots.
+//
+
+#define ALLOC_SITE_DEPTH 4 // how many actions on the stack identify a site
+
+enum {
+    IDX_SITE_BYTES,
+    IDX_SITE_LIVE,
+    IDX_SITE_SAMPLES,
+    IDX_SITE_WIDE,
+    IDX_SITE_FRAMES, // label, file, and line for up to ALLOC_SITE_DEPTH
+    IDX_SITE_MAX = IDX_SITE_FRAMES + (3 * ALLOC_SITE_DEPTH)
+};
+
+struct Reb_Alloc_Sample {
+    REBSER *s;
+    REBCNT site; // index of the site's group in Root_Alloc_Sites
+    REBI64 bytes; // how many bytes the sample stands for
+};
+
+#define MIN_ALLOC_SLOTS 64 // must be a power of 2
+
+struct Reb_Alloc_Frame {
+    REBSTR *label; // NULL if the action was run anonymously
+    REBSTR *file; // NULL if not known
+    REBLIN line; // 0 if not known
+};
+
+
+//
+//  Note_Alloc_Frame: C
+//
+static void Note_Alloc_Frame(struct Reb_Alloc_Frame *frame, REBFRM *f)
+{
+    assert(Is_Action_Frame(f));
+
+    frame->label = f->opt_label;
+
+    REBSTR *file = FRM_FILE(f);
+    frame->file = (STR_SYMBOL(file) == SYM___ANONYMOUS__) ? NULL : file;
+    frame->line = FRM_LINE(f);
+}
+
+
+//
+//  Hash_Alloc_Frame: C
+//
+// Mix a frame's label, file, and line into a hash of a site or stack.
+//
+static REBCNT Hash_Alloc_Frame(REBCNT hash, struct Reb_Alloc_Frame *frame)
+{
+    uintptr_t bits = cast(uintptr_t, frame->label)
+        ^ (cast(uintptr_t, frame->file) << 1)
+        ^ frame->line;
+    return (hash * 31) + cast(REBCNT, bits ^ (bits >> 16));
+}
+
+
+inline static REBCNT Alloc_Sample_Slot(REBSER *s, REBCNT mask) {
+    uintptr_t bits = cast(uintptr_t, s) >> 4; // nodes are aligned
+    return cast(REBCNT, (bits * 2654435761u) >> 8) & mask;
+}
+
+
+//
+//  Make_Alloc_Site_Slots: C
+//
+// Make an empty table for finding sites by hash, with the given number of
+// slots (a power of 2).  Its length is the number of slots.
+//
+static REBSER *Make_Alloc_Site_Slots(REBCNT num_slots)
+{
+    assert((num_slots & (num_slots - 1)) == 0);
+
+    REBSER *slots = Make_Series(num_slots, sizeof(REBCNT));
+    memset(SER_DATA_RAW(slots), 0, num_slots * sizeof(REBCNT));
+    SET_SERIES_LEN(slots, num_slots);
+    return slots;
+}
+
+
+//
+//  Startup_Alloc_Profiler: C
+//
+void Startup_Alloc_Profiler(void)
+{
+    Root_Alloc_Sites = Init_Block(Alloc_Value(), Make_Array(0));
+    TG_Alloc_Site_Hashes = Make_Series(10, sizeof(REBCNT));
+    TG_Alloc_Site_Slots = Make_Alloc_Site_Slots(MIN_ALLOC_SLOTS);
+    TG_Alloc_Samples = ALLOC_N_ZEROFILL(
+        struct Reb_Alloc_Sample, MIN_ALLOC_SLOTS
+    );
+    TG_Alloc_Sample_Slots = MIN_ALLOC_SLOTS;
+    TG_Alloc_Sample_Count = 0;
+    TG_Sample_Every = 0;
+}
+
+
+//
+//  Forget_Alloc_Samples: C
+//
+// Clear SERIES_INFO_SAMPLED from the sampled series that are still alive,
+// so freeing them won't try to update the tallies.
+//
+static void Forget_Alloc_Samples(void)
+{
+    struct Reb_Alloc_Sample *samples = TG_Alloc_Samples;
+    REBCNT n;
+    for (n = 0; n < TG_Alloc_Sample_Slots; ++n) {
+        if (samples[n].s == NULL)
+            continue;
+        CLEAR_SER_INFO(samples[n].s, SERIES_INFO_SAMPLED);
+        samples[n].s = NULL;
+    }
+    TG_Alloc_Sample_Count = 0;
+}
+
+
+//
+//  Shutdown_Alloc_Profiler: C
+//
+void Shutdown_Alloc_Profiler(void)
+{
+    TG_Sample_Every = 0;
+    Forget_Alloc_Samples();
+
+    FREE_N(
+        struct Reb_Alloc_Sample, TG_Alloc_Sample_Slots, TG_Alloc_Samples
+    );
+    TG_Alloc_Samples = NULL;
+
+    Free_Series(TG_Alloc_Site_Slots);
+    TG_Alloc_Site_Slots = NULL;
+    Free_Series(TG_Alloc_Site_Hashes);
+    TG_Alloc_Site_Hashes = NULL;
+
+    rebRelease(Root_Alloc_Sites);
+    Root_Alloc_Sites = NULL;
+}
+
+
+//
+//  Match_Alloc_Frame: C
+//
+// See if a site's cells for a frame hold the given frame's label, file, and
+// line.  A NULL spelling or a 0 line is stored as a BLANK!, so frames that
+// are unused (past the depth of the stack when sampled) are all blanks.
+//
+static REBOOL Match_Alloc_Frame(
+    const RELVAL *cells,
+    struct Reb_Alloc_Frame *frame
+){
+    REBSTR *spellings[2] = {frame->label, frame->file};
+
+    REBCNT n;
+    for (n = 0; n < 2; ++n) {
+        if (spellings[n] == NULL) {
+            if (not IS_BLANK(cells + n))
+                return FALSE;
+        }
+        else if (
+            not IS_WORD(cells + n)
+            or VAL_WORD_SPELLING(cells + n) != spellings[n]
+        ){
+            return FALSE;
+        }
+    }
+
+    if (frame->line == 0)
+        return IS_BLANK(cells + 2);
+    return IS_INTEGER(cells + 2)
+        and VAL_INT64(cells + 2) == cast(REBI64, frame->line);
+}
+
+
+//
+//  Append_Alloc_Frame: C
+//
+// Add the cells for a frame that Match_Alloc_Frame() checks against.
+//
+static void Append_Alloc_Frame(REBARR *a, struct Reb_Alloc_Frame *frame)
+{
+    if (frame->label == NULL)
+        Init_Blank(Alloc_Tail_Array(a));
+    else
+        Init_Word(Alloc_Tail_Array(a), frame->label);
+
+    if (frame->file == NULL)
+        Init_Blank(Alloc_Tail_Array(a));
+    else
+        Init_Word(Alloc_Tail_Array(a), frame->file);
+
+    if (frame->line == 0)
+        Init_Blank(Alloc_Tail_Array(a));
+    else
+        Init_Integer(Alloc_Tail_Array(a), frame->line);
+}
+
+
+//
+//  Rehash_Alloc_Sites: C
+//
+// Double the number of slots for finding sites, once they're half full.
+// Slots hold 1 + the number of a site, or 0 if they are empty.
+//
+static void Rehash_Alloc_Sites(void)
+{
+    REBCNT num_slots = SER_LEN(TG_Alloc_Site_Slots) * 2;
+    Free_Series(TG_Alloc_Site_Slots);
+    TG_Alloc_Site_Slots = Make_Alloc_Site_Slots(num_slots);
+
+    REBCNT *slots = SER_HEAD(REBCNT, TG_Alloc_Site_Slots);
+    REBCNT *hashes = SER_HEAD(REBCNT, TG_Alloc_Site_Hashes);
+    REBCNT mask = num_slots - 1;
+
+    REBCNT num;
+    for (num = 0; num < SER_LEN(TG_Alloc_Site_Hashes); ++num) {
+        REBCNT slot = hashes[num] & mask;
+        while (slots[slot] != 0)
+            slot = (slot + 1) & mask;
+        slots[slot] = num + 1;
+    }
+}
+
+
+//
+//  Find_Or_Add_Alloc_Site: C
+//
+// Get the index of the group in Root_Alloc_Sites tallying allocations of the
+// given width made from the given frames, adding a group if there is none.
+//
+static REBCNT Find_Or_Add_Alloc_Site(
+    struct Reb_Alloc_Frame *frames, // ALLOC_SITE_DEPTH of them
+    REBCNT wide
+){
+    REBARR *sites = VAL_ARRAY(Root_Alloc_Sites);
+    REBCNT *hashes = SER_HEAD(REBCNT, TG_Alloc_Site_Hashes);
+
+    REBCNT hash = wide;
+    REBCNT n;
+    for (n = 0; n < ALLOC_SITE_DEPTH; ++n)
+        hash = Hash_Alloc_Frame(hash, &frames[n]);
+
+    REBCNT *slots = SER_HEAD(REBCNT, TG_Alloc_Site_Slots);
+    REBCNT mask = SER_LEN(TG_Alloc_Site_Slots) - 1;
+    REBCNT slot = hash & mask;
+    for (; slots[slot] != 0; slot = (slot + 1) & mask) {
+        REBCNT num = slots[slot] - 1;
+        if (hashes[num] != hash)
+            continue;
+
+        RELVAL *site = ARR_AT(sites, num * IDX_SITE_MAX);
+        if (VAL_INT64(site + IDX_SITE_WIDE) != cast(REBI64, wide))
+            continue;
+
+        for (n = 0; n < ALLOC_SITE_DEPTH; ++n) {
+            if (not Match_Alloc_Frame(
+                site + IDX_SITE_FRAMES + (3 * n), &frames[n]
+            )){
+                break;
+            }
+        }
+        if (n == ALLOC_SITE_DEPTH)
+            return num * IDX_SITE_MAX;
+    }
+
+    REBCNT index = ARR_LEN(sites);
+    REBCNT num = index / IDX_SITE_MAX;
+    assert(num == SER_LEN(TG_Alloc_Site_Hashes));
+
+    Init_Integer(Alloc_Tail_Array(sites), 0); // IDX_SITE_BYTES
+    Init_Integer(Alloc_Tail_Array(sites), 0); // IDX_SITE_LIVE
+    Init_Integer(Alloc_Tail_Array(sites), 0); // IDX_SITE_SAMPLES
+    Init_Integer(Alloc_Tail_Array(sites), wide); // IDX_SITE_WIDE
+
+    for (n = 0; n < ALLOC_SITE_DEPTH; ++n)
+        Append_Alloc_Frame(sites, &frames[n]);
+
+    EXPAND_SERIES_TAIL(TG_Alloc_Site_Hashes, 1);
+    *SER_LAST(REBCNT, TG_Alloc_Site_Hashes) = hash;
+
+    slots[slot] = num + 1;
+
+    if ((num + 1) * 2 > SER_LEN(TG_Alloc_Site_Slots)) // keep probes short
+        Rehash_Alloc_Sites();
+
+    return index;
+}
+
+
+//
+//  Add_Alloc_Sample: C
+//
+// Put a series in the table of samples.  It must not be in it already.
+//
+static void Add_Alloc_Sample(REBSER *s, REBCNT site, REBI64 bytes)
+{
+    if ((TG_Alloc_Sample_Count + 1) * 2 > TG_Alloc_Sample_Slots) {
+        struct Reb_Alloc_Sample *old = TG_Alloc_Samples;
+        REBCNT old_slots = TG_Alloc_Sample_Slots;
+
+        TG_Alloc_Sample_Slots = old_slots * 2;
+        TG_Alloc_Samples = ALLOC_N_ZEROFILL(
+            struct Reb_Alloc_Sample, TG_Alloc_Sample_Slots
+        );
+        TG_Alloc_Sample_Count = 0;
+
+        REBCNT n;
+        for (n = 0; n < old_slots; ++n) {
+            if (old[n].s != NULL)
+                Add_Alloc_Sample(old[n].s, old[n].site, old[n].bytes);
+        }
+        FREE_N(struct Reb_Alloc_Sample, old_slots, old);
+    }
+
+    struct Reb_Alloc_Sample *samples = TG_Alloc_Samples;
+    REBCNT mask = TG_Alloc_Sample_Slots - 1;
+    REBCNT slot = Alloc_Sample_Slot(s, mask);
+    while (samples[slot].s != NULL) {
+        assert(samples[slot].s != s);
+        slot = (slot + 1) & mask;
+    }
+
+    samples[slot].s = s;
+    samples[slot].site = site;
+    samples[slot].bytes = bytes;
+    ++TG_Alloc_Sample_Count;
+}
+
+
+//
+//  Sample_Allocation: C
+//
+// Called when the allocation profiler is on, with the number of bytes that
+// were allocated for a series.  Every TG_Sample_Every bytes, the series is
+// sampled and its call site credited with the bytes since the last sample.
+//
+void Sample_Allocation(REBSER *s, REBCNT bytes)
+{
+    assert(TG_Sample_Every > 0);
+
+    static REBOOL sampling = FALSE; // adding a site allocates
+    if (sampling or GC_Recycling)
+        return;
+
+    TG_Sample_Countdown -= bytes;
+    if (TG_Sample_Countdown > 0)
+        return;
+
+    REBI64 weight = TG_Sample_Every * (1 + (- TG_Sample_Countdown)
+        / TG_Sample_Every);
+    TG_Sample_Countdown += weight;
+
+    struct Reb_Alloc_Frame frames[ALLOC_SITE_DEPTH];
+    REBCNT depth = 0;
+
+    REBFRM *f;
+    for (f = FS_TOP; f != NULL and depth < ALLOC_SITE_DEPTH; f = f->prior) {
+        if (not Is_Action_Frame(f))
+            continue;
+
+        Note_Alloc_Frame(&frames[depth], f);
+        ++depth;
+    }
+    for (; depth < ALLOC_SITE_DEPTH; ++depth) {
+        frames[depth].label = NULL;
+        frames[depth].file = NULL;
+        frames[depth].line = 0;
+    }
+
+    sampling = TRUE; // (the tallies and list of samples may be expanded)
+
+    REBCNT site = Find_Or_Add_Alloc_Site(frames, SER_WIDE(s));
+
+    RELVAL *tally = ARR_AT(VAL_ARRAY(Root_Alloc_Sites), site);
+    VAL_INT64(tally + IDX_SITE_BYTES) += weight;
+    VAL_INT64(tally + IDX_SITE_SAMPLES) += 1;
+
+    // A series that was already sampled (e.g. one being expanded) is left
+    // with the site it was first sampled at for its live bytes.
+    //
+    if (NOT_SER_INFO(s, SERIES_INFO_SAMPLED)) {
+        VAL_INT64(tally + IDX_SITE_LIVE) += weight;
+
+        SET_SER_INFO(s, SERIES_INFO_SAMPLED);
+        Add_Alloc_Sample(s, site, weight);
+    }
+
+    sampling = FALSE;
+}
+
+
+//
+//  Unsample_Series: C
+//
+// Called when a series with SERIES_INFO_SAMPLED is freed, to take the bytes
+// it stood for off the live tally of its site.  This can run during a sweep,
+// so it must not allocate.
+//
+void Unsample_Series(REBSER *s)
+{
+    CLEAR_SER_INFO(s, SERIES_INFO_SAMPLED);
+
+    struct Reb_Alloc_Sample *samples = TG_Alloc_Samples;
+    REBCNT mask = TG_Alloc_Sample_Slots - 1;
+    REBCNT slot = Alloc_Sample_Slot(s, mask);
+    for (; samples[slot].s != s; slot = (slot + 1) & mask) {
+        if (samples[slot].s == NULL)
+            return; // forgotten by SAMPLE-ALLOCATIONS/EVERY
+    }
+
+    RELVAL *tally = ARR_AT(VAL_ARRAY(Root_Alloc_Sites), samples[slot].site);
+    VAL_INT64(tally + IDX_SITE_LIVE) -= samples[slot].bytes;
+    --TG_Alloc_Sample_Count;
+
+    // Removing an entry from a linear probing table can't just empty its
+    // slot, or samples placed past it would not be found.  Instead, later
+    // entries in the run are moved back into the hole when their probe
+    // would have reached it (this way no "deleted" markers are needed).
+    //
+    REBCNT hole = slot;
+    REBCNT next = slot;
+    while (TRUE) {
+        next = (next + 1) & mask;
+        if (samples[next].s == NULL)
+            break;
+
+        REBCNT home = Alloc_Sample_Slot(samples[next].s, mask);
+        REBOOL stays = (hole <= next)
+            ? (hole < home and home <= next)
+            : (hole < home or home <= next);
+        if (stays)
+            continue;
+
+        samples[hole] = samples[next];
+        hole = next;
+    }
+    samples[hole].s = NULL;
+}
+
+
+//
+//  sample-allocations: native [
+//
+//  {Find out which code is making series, by sampling the allocations}
+//
+//      return: [<opt> block!]
+//          {[bytes live samples width [label file line ...]] for each site}
+//      /every
+//          "Start sampling afresh, once per this many bytes (0 to stop)"
+//      bytes [integer!]
+//  ]
+//
+REBNATIVE(sample_allocations)
+{
+    INCLUDE_PARAMS_OF_SAMPLE_ALLOCATIONS;
+
+    REBARR *sites = VAL_ARRAY(Root_Alloc_Sites);
+
+    if (REF(every)) {
+        REBI64 every = VAL_INT64(ARG(bytes));
+        if (every < 0)
+            fail (Error_Invalid(ARG(bytes)));
+
+        TG_Sample_Every = every;
+        if (every == 0)
+            return R_VOID; // stop, but keep the tallies
+
+        Forget_Alloc_Samples();
+        TERM_ARRAY_LEN(sites, 0);
+        SET_SERIES_LEN(TG_Alloc_Site_Hashes, 0);
+        memset(
+            SER_DATA_RAW(TG_Alloc_Site_Slots),
+            0,
+            SER_LEN(TG_Alloc_Site_Slots) * sizeof(REBCNT)
+        );
+        TG_Sample_Countdown = every;
+        return R_VOID;
+    }
+
+    REBDSP dsp_orig = DSP;
+
+    REBCNT index;
+    for (index = 0; index < ARR_LEN(sites); index += IDX_SITE_MAX) {
+        RELVAL *site = ARR_AT(sites, index);
+
+        REBARR *frames = Copy_Values_Len_Shallow(
+            site + IDX_SITE_FRAMES, SPECIFIED, 3 * ALLOC_SITE_DEPTH
+        );
+        while ( // drop unused frames
+            ARR_LEN(frames) > 0
+            and IS_BLANK(ARR_LAST(frames))
+            and IS_BLANK(ARR_LAST(frames) - 1)
+            and IS_BLANK(ARR_LAST(frames) - 2)
+        ){
+            TERM_ARRAY_LEN(frames, ARR_LEN(frames) - 3);
+        }
+
+        REBARR *group = Copy_Values_Len_Extra_Shallow(
+            site, SPECIFIED, IDX_SITE_FRAMES, 1
+        );
+        Init_Block(Alloc_Tail_Array(group), frames);
+
+        DS_PUSH_TRASH;
+        Init_Block(DS_TOP, group);
+    }
+
+    Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+    return R_OUT;
+}
+
+
+//=//// CPU PROFILER //////////////////////////////////////////////////////=//
+//
+// PROFILE/START sets a timer that raises SIG_PROFILE, so the evaluator looks
+// at its stack the next time it starts an expression (see Do_Signals_Throws)
+// and counts that stack of actions as one sample.  Linux uses a SIGPROF
+// interval timer, which ticks with the CPU time used by the process.  Where
+// there's no such timer, a sample is taken each time an Eval_Dose runs out,
+// so samples measure evaluation steps instead.
+//
+// As the evaluator isn't interrupted in the middle of an expression, time in
+// a native is counted for the expression that comes after it.  When off,
+// the profiler costs nothing: it only adds a bit to the signals checked when
+// Eval_Count runs out.
+//
+// Each distinct stack gets two cells in Root_Profile_Stacks, the number of
+// samples and a BLOCK! of label, file, and line for each action, innermost
+// first (the same cells the allocation profiler uses for its sites).  The
+// hash of each stack is kept in TG_Profile_Hashes to speed up matching.
+//
+
+#define PROFILE_MAX_DEPTH 64 // deeper stacks keep only the innermost actions
+#define PROFILE_DEFAULT_USECS 1000
+
+enum {
+    IDX_STACK_SAMPLES,
+    IDX_STACK_FRAMES,
+    IDX_STACK_MAX
+};
+
+
+//
+//  Startup_Profiler: C
+//
+void Startup_Profiler(void)
+{
+    Root_Profile_Stacks = Init_Block(Alloc_Value(), Make_Array(0));
+    TG_Profile_Hashes = Make_Series(10, sizeof(REBCNT));
+    TG_Profiling = FALSE;
+
+    TG_Metrics_Calls = Make_Series(10, sizeof(struct Reb_Metric_Call));
+}
+
+
+#ifdef HAS_POSIX_SIGNAL
+
+static struct sigaction Profile_Old_Action;
+
+static void Handle_Profile_Signal(int sig)
+{
+    UNUSED(sig);
+    SET_SIGNAL(SIG_PROFILE);
+}
+
+#endif
+
+
+//
+//  Start_Profile_Timer: C
+//
+static void Start_Profile_Timer(REBI64 usecs)
+{
+  #ifdef HAS_POSIX_SIGNAL
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = &Handle_Profile_Signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART; // don't make I/O fail with EINTR
+    sigaction(SIGPROF, &action, &Profile_Old_Action);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = usecs / 1000000;
+    timer.it_interval.tv_usec = usecs % 1000000;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, NULL);
+  #else
+    UNUSED(usecs);
+  #endif
+}
+
+
+//
+//  Stop_Profile_Timer: C
+//
+static void Stop_Profile_Timer(void)
+{
+  #ifdef HAS_POSIX_SIGNAL
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+
+    sigaction(SIGPROF, &Profile_Old_Action, NULL);
+  #endif
+}
+
+
+//
+//  Shutdown_Profiler: C
+//
+void Shutdown_Profiler(void)
+{
+    if (TG_Profiling) {
+        Stop_Profile_Timer();
+        TG_Profiling = FALSE;
+    }
+
+    Free_Series(TG_Profile_Hashes);
+    TG_Profile_Hashes = NULL;
+
+    Free_Series(TG_Metrics_Calls);
+    TG_Metrics_Calls = NULL;
+
+    rebRelease(Root_Profile_Stacks);
+    Root_Profile_Stacks = NULL;
+}
+
+
+//
+//  Sample_Profile: C
+//
+// Called from Do_Signals_Throws() on SIG_PROFILE, to count the stack of
+// actions being run as one more sample.
+//
+void Sample_Profile(void)
+{
+    struct Reb_Alloc_Frame frames[PROFILE_MAX_DEPTH];
+    REBCNT depth = 0;
+    REBCNT hash = 0;
+
+    REBFRM *f;
+    for (f = FS_TOP; f != NULL and depth < PROFILE_MAX_DEPTH; f = f->prior) {
+        if (not Is_Action_Frame(f))
+            continue;
+
+        Note_Alloc_Frame(&frames[depth], f);
+        hash = Hash_Alloc_Frame(hash, &frames[depth]);
+        ++depth;
+    }
+
+    REBARR *stacks = VAL_ARRAY(Root_Profile_Stacks);
+    REBCNT *hashes = SER_HEAD(REBCNT, TG_Profile_Hashes);
+
+    REBCNT n;
+    for (n = 0; n < SER_LEN(TG_Profile_Hashes); ++n) {
+        if (hashes[n] != hash)
+            continue;
+
+        RELVAL *stack = ARR_AT(stacks, n * IDX_STACK_MAX);
+        RELVAL *cells = VAL_ARRAY_HEAD(stack + IDX_STACK_FRAMES);
+        if (VAL_LEN_HEAD(stack + IDX_STACK_FRAMES) != 3 * depth)
+            continue;
+
+        REBCNT i;
+        for (i = 0; i < depth; ++i) {
+            if (not Match_Alloc_Frame(cells + (3 * i), &frames[i]))
+                break;
+        }
+        if (i == depth) {
+            VAL_INT64(stack + IDX_STACK_SAMPLES) += 1;
+            return;
+        }
+    }
+
+    REBARR *a = Make_Array(3 * depth);
+    REBCNT i;
+    for (i = 0; i < depth; ++i)
+        Append_Alloc_Frame(a, &frames[i]);
+
+    Init_Integer(Alloc_Tail_Array(stacks), 1); // IDX_STACK_SAMPLES
+    Init_Block(Alloc_Tail_Array(stacks), a); // IDX_STACK_FRAMES
+
+    EXPAND_SERIES_TAIL(TG_Profile_Hashes, 1);
+    *SER_LAST(REBCNT, TG_Profile_Hashes) = hash;
+}
+
+
+//
+//  Append_Profile_Name: C
+//
+// Name an action in the folded stacks from its cells in a sampled stack.
+//
+static void Append_Profile_Name(REBSER *buf, const RELVAL *cells)
+{
+    if (IS_BLANK(cells))
+        Append_Unencoded(buf, "(anonymous)");
+    else {
+        REBSTR *label = VAL_WORD_SPELLING(cells);
+        Append_Utf8_Utf8(buf, STR_HEAD(label), STR_SIZE(label));
+    }
+}
+
+
+struct Reb_Profile_Action {
+    REBSTR *label; // NULL for actions run anonymously
+    REBI64 self; // samples with the action innermost on the stack
+    REBI64 total; // samples with the action anywhere on the stack
+    REBI64 stamp; // last stack counted in the total (avoids recursion)
+};
+
+
+// qsort() callback for putting actions in order of most samples first.
+//
+static int Compare_Profile_Actions(const void *a, const void *b)
+{
+    REBI64 x = cast(const struct Reb_Profile_Action*, a)->total;
+    REBI64 y = cast(const struct Reb_Profile_Action*, b)->total;
+    return x > y ? -1 : (x < y ? 1 : 0);
+}
+
+
+//
+//  Top_Profile_Actions: C
+//
+// Make a block of [total self label] blocks for the `limit` actions in the
+// most samples.
+//
+static REBARR *Top_Profile_Actions(REBCNT limit)
+{
+    REBARR *stacks = VAL_ARRAY(Root_Profile_Stacks);
+
+    REBSER *actions = Make_Series(10, sizeof(struct Reb_Profile_Action));
+
+    REBCNT index;
+    for (index = 0; index < ARR_LEN(stacks); index += IDX_STACK_MAX) {
+        RELVAL *stack = ARR_AT(stacks, index);
+        REBI64 samples = VAL_INT64(stack + IDX_STACK_SAMPLES);
+        RELVAL *cells = VAL_ARRAY_HEAD(stack + IDX_STACK_FRAMES);
+        REBCNT depth = VAL_LEN_HEAD(stack + IDX_STACK_FRAMES) / 3;
+
+        REBCNT i;
+        for (i = 0; i < depth; ++i) {
+            REBSTR *label = IS_BLANK(cells + (3 * i))
+                ? NULL
+                : VAL_WORD_SPELLING(cells + (3 * i));
+
+            struct Reb_Profile_Action *action = SER_HEAD(
+                struct Reb_Profile_Action, actions
+            );
+            REBCNT n;
+            for (n = 0; n < SER_LEN(actions); ++n, ++action) {
+                if (action->label == label)
+                    break;
+            }
+            if (n == SER_LEN(actions)) {
+                EXPAND_SERIES_TAIL(actions, 1);
+                action = SER_LAST(struct Reb_Profile_Action, actions);
+                action->label = label;
+                action->self = 0;
+                action->total = 0;
+                action->stamp = -1;
+            }
+
+            if (i == 0)
+                action->self += samples;
+            if (action->stamp != cast(REBI64, index)) {
+                action->total += samples;
+                action->stamp = index;
+            }
+        }
+    }
+
+    qsort(
+        SER_HEAD(struct Reb_Profile_Action, actions),
+        SER_LEN(actions),
+        sizeof(struct Reb_Profile_Action),
+        &Compare_Profile_Actions
+    );
+
+    if (limit > SER_LEN(actions))
+        limit = SER_LEN(actions);
+
+    REBARR *top = Make_Array(limit);
+
+    struct Reb_Profile_Action *action = SER_HEAD(
+        struct Reb_Profile_Action, actions
+    );
+    REBCNT n;
+    for (n = 0; n < limit; ++n, ++action) {
+        REBARR *row = Make_Array(3);
+        Init_Integer(Alloc_Tail_Array(row), action->total);
+        Init_Integer(Alloc_Tail_Array(row), action->self);
+        if (action->label == NULL)
+            Init_Blank(Alloc_Tail_Array(row));
+        else
+            Init_Word(Alloc_Tail_Array(row), action->label);
+
+        Init_Block(Alloc_Tail_Array(top), row);
+    }
+
+    Free_Series(actions);
+    return top;
+}
+
+
+//
+//  profile: native [
+//
+//  {Find out where the evaluator spends its time, by sampling its stack}
+//
+//      return: [<opt> block! text!]
+//          {[samples [label file line ...]] for each stack, innermost first}
+//      /start
+//          "Start sampling afresh"
+//      /every
+//          "Start sampling afresh, this often (default is 1 millisecond)"
+//      interval [time!]
+//      /stop
+//          "Stop sampling, but keep the samples"
+//      /folded
+//          {Stacks as "outer;...;inner samples" lines, for flame graphs}
+//      /top
+//          "The actions in the most samples, as [total self label] blocks"
+//      limit [integer!]
+//  ]
+//
+REBNATIVE(profile)
+{
+    INCLUDE_PARAMS_OF_PROFILE;
+
+    REBARR *stacks = VAL_ARRAY(Root_Profile_Stacks);
+
+    if (REF(stop)) {
+        if (TG_Profiling) {
+            Stop_Profile_Timer();
+            TG_Profiling = FALSE;
+        }
+        return R_VOID;
+    }
+
+    if (REF(start) or REF(every)) {
+        REBI64 usecs = PROFILE_DEFAULT_USECS;
+        if (REF(every)) {
+            usecs = VAL_NANO(ARG(interval)) / 1000;
+            if (usecs <= 0 or usecs > INT32_MAX)
+                fail (Error_Invalid(ARG(interval)));
+        }
+
+        if (TG_Profiling)
+            Stop_Profile_Timer();
+
+        TERM_ARRAY_LEN(stacks, 0);
+        SET_SERIES_LEN(TG_Profile_Hashes, 0);
+
+        TG_Profiling = TRUE;
+        Start_Profile_Timer(usecs);
+        return R_VOID;
+    }
+
+    if (REF(top)) {
+        if (VAL_INT64(ARG(limit)) < 0)
+            fail (Error_Invalid(ARG(limit)));
+        Init_Block(D_OUT, Top_Profile_Actions(VAL_INT32(ARG(limit))));
+        return R_OUT;
+    }
+
+    if (REF(folded)) {
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+
+        REBCNT index;
+        for (index = 0; index < ARR_LEN(stacks); index += IDX_STACK_MAX) {
+            RELVAL *stack = ARR_AT(stacks, index);
+            RELVAL *cells = VAL_ARRAY_HEAD(stack + IDX_STACK_FRAMES);
+            REBCNT depth = VAL_LEN_HEAD(stack + IDX_STACK_FRAMES) / 3;
+
+            if (depth == 0)
+                Append_Unencoded(mo->series, "(top)");
+
+            REBCNT i;
+            for (i = depth; i > 0; --i) { // outermost first
+                Append_Profile_Name(mo->series, cells + (3 * (i - 1)));
+                if (i > 1)
+                    Append_Unencoded(mo->series, ";");
+            }
+            Append_Unencoded(mo->series, " ");
+            Append_Int(
+                mo->series,
+                cast(REBINT, VAL_INT64(stack + IDX_STACK_SAMPLES))
+            );
+            Append_Unencoded(mo->series, "\n");
+        }
+
+        Init_Text(D_OUT, Pop_Molded_String(mo));
+        return R_OUT;
+    }
+
+    REBDSP dsp_orig = DSP;
+
+    REBCNT index;
+    for (index = 0; index < ARR_LEN(stacks); index += IDX_STACK_MAX) {
+        DS_PUSH_TRASH;
+        Init_Block(
+            DS_TOP,
+            Copy_Values_Len_Shallow(
+                ARR_AT(stacks, index), SPECIFIED, IDX_STACK_MAX
+            )
+        );
+    }
+
+    Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+    return R_OUT;
+}
@@ -50,6 +50,8 @@ REBCNT Modify_Array(
     const RELVAL *src_rel;
     REBSPC *specifier;
 
+    Note_Array_Modified(SER(dst_arr));
+
     if (IS_VOID(src_val) or dups <= 0) {
         // If they are effectively asking for "no action" then all we have
         // to do is return the natural index result for the operation.
@@ -338,7 +340,11 @@ REBCNT Modify_Binary(
 
     // For dup count:
     for (; dups > 0; dups--) {
-        memcpy(BIN_AT(dst_ser, dst_idx), BIN_AT(src_ser, src_idx), src_len);
+        memcpy(
+            SER_SPAN(REBYTE, dst_ser, dst_idx, src_len), // may keep a gap
+            BIN_AT(src_ser, src_idx),
+            src_len
+        );
         dst_idx += src_len;
     }
 
@@ -461,7 +467,7 @@ REBCNT Modify_String(
     // For dup count:
     for (; dups > 0; dups--) {
         memcpy(
-            AS_REBUNI(UNI_AT(dst_ser, dst_idx)),
+            SER_SPAN(REBUNI, dst_ser, dst_idx, src_len), // may keep a gap
             AS_REBUNI(UNI_AT(src_ser, src_idx)),
             sizeof(REBUNI) * src_len
         );
@@ -56,14 +56,61 @@
 // spot).  This queue is then handled as soon as the marking call is exited,
 // and the process repeated until no more items are queued.
 //
-// !!! There is actually not a specific list of roots of the garbage collect,
-// so a first pass of all the REBSER nodes must be done to find them.  This is
-// because with the redesigned "RL_API" in Ren-C, ordinary REBSER nodes do
-// double duty as lifetime-managed containers for REBVALs handed out by the
-// API--without requiring a separate series data allocation.  These could be
-// in their own "pool", but that would prevent mingling and reuse among REBSER
-// nodes used for other purposes.  Review in light of any new garbage collect
-// approaches used.
+// With the redesigned "RL_API" in Ren-C, ordinary REBSER nodes do double duty
+// as lifetime-managed containers for REBVALs handed out by the API--without
+// requiring a separate series data allocation.  Rather than find these roots
+// with a pass over all the REBSER nodes, they are listed in GC_Roots as they
+// are allocated (see %sys-roots.h).
+//
+// PARALLEL MARKING
+//
+// If the interpreter is built with GC_PARALLEL_MARK (PARALLEL-MARK: YES in
+// the build config), then RECYCLE/PARALLEL can ask for helper threads to be
+// used once a Propagate_All_GC_Marks() has enough pending arrays to make it
+// worth it.  Each marker then works from its own stack, and when it has a
+// surplus while other markers are idle it moves the older half of its stack
+// to a shared list, from which idle markers take work.  Mark bits are set
+// with an atomic operation, so only one marker can win the right to queue
+// an array.  Debug builds always mark on a single thread, since the checks
+// made while marking are not thread-safe (and it keeps them deterministic).
+//
+// LAZY SWEEPING
+//
+// Sweeping touches every node in every SER_POOL segment, so the pause for a
+// full recycle grows with the heap even when little of it is garbage.  With
+// RECYCLE/LAZY on, an automatic full recycle only marks.  The free list of
+// the pool is emptied, and segments are swept one at a time by Make_Node()
+// when it runs out of free nodes (GC_Sweep_Seg is the next segment due).
+// Sweeping a segment relinks its free nodes, so nodes in segments that have
+// not been swept yet are never handed out.  Any recycle--and RECYCLE itself,
+// which sweeps everything before returning its count--first finishes a
+// pending sweep, so marking always starts from a clean slate.
+//
+// Until its segment is swept, a dead series can't be reached by the program
+// with one exception: the table of interned strings, which is weak.  Hence
+// the dead strings are removed when the marking finishes, as usual.  Then
+// while a sweep is pending, a series that becomes managed is marked and kept
+// in GC_Sweep_Keeps (else an unswept segment would see it as garbage) and
+// Free_Node() does not link nodes into the free list (else a node in an
+// unswept segment could be handed out, and then swept).  The next sweep of
+// its segment picks it up.
+//
+// A sweep done by Make_Node() is in the middle of some allocation, so it
+// can't run code that might not expect that: a HANDLE!'s cleaner, or the
+// allocation profiler's bookkeeping (see Kill_Needs_Safe_Point()).  Dead
+// series like these are marked and put in GC_Sweep_Deferred instead, and
+// freed by Finish_Series_Sweep()--which is only called from recycles and
+// other places where anything may run.
+//
+// THE AUTO-RECYCLE TRIGGER
+//
+// R3-Alpha recycled whenever a fixed MEM_BALLAST of bytes had been allocated
+// since the last recycle, so a program with a large live heap paid for a
+// full mark of it every few megabytes.  Now each full recycle measures the
+// memory still in use, and the next automatic recycle waits until as much
+// again times (gc-growth - 1) has been allocated.  The growth factor and the
+// bounds on the ballast are read from SYSTEM/OPTIONS (see Adapt_Ballast()).
+// RECYCLE/BALLAST and RECYCLE/TORTURE still ask for a fixed ballast.
 //
 
 #include "sys-core.h"
@@ -73,6 +120,11 @@
 
 #include "sys-int-funcs.h"
 
+#if defined(GC_PARALLEL_MARK) && defined(NDEBUG)
+    #define PARALLEL_MARKING
+    #include <pthread.h>
+#endif
+
 
 //
 // !!! In R3-Alpha, the core included specialized structures which required
@@ -117,6 +169,127 @@ static void Mark_Devices_Deep(void);
     assert(SER_LEN(GC_Mark_Stack) == 0)
 
 
+#ifdef PARALLEL_MARKING
+    #define MAX_MARK_HELPERS 64
+
+    // Serial marking switches to parallel when this many arrays are pending,
+    // and a marker only shares work when it has more than this many.
+    //
+    #define MARK_PARALLEL_THRESHOLD 256
+    #define MARK_SHARE_THRESHOLD 64
+
+    // Helper threads can't make series (the pools aren't thread-safe), so
+    // each marker's pending arrays are kept in plain malloc()'d arrays.
+    //
+    struct Reb_Marker {
+        REBARR **stack;
+        REBCNT len;
+        REBCNT rest;
+
+        REBCNT job; // last job number seen (helpers only)
+    };
+
+    static __thread struct Reb_Marker *Marker; // NULL unless in parallel job
+
+    static struct Reb_Marker Markers[MAX_MARK_HELPERS + 1]; // [0] is main
+    static pthread_t Mark_Threads[MAX_MARK_HELPERS];
+    static REBCNT Num_Mark_Threads; // helper threads started so far
+
+    static pthread_mutex_t Mark_Mutex = PTHREAD_MUTEX_INITIALIZER;
+    static pthread_cond_t Mark_Job_Cond = PTHREAD_COND_INITIALIZER;
+    static pthread_cond_t Mark_Work_Cond = PTHREAD_COND_INITIALIZER;
+    static pthread_cond_t Mark_Done_Cond = PTHREAD_COND_INITIALIZER;
+
+    // GOB!s and EVENT!s use C structs with their own mark bits, which are
+    // not updated atomically...so markers take turns with them.
+    //
+    static pthread_mutex_t Mark_Struct_Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+    // These are protected by Mark_Mutex (Idle_Markers is also peeked at
+    // without the lock, as a hint of whether sharing work is worthwhile.)
+    //
+    static REBARR **Shared_Marks;
+    static REBCNT Shared_Len;
+    static REBCNT Shared_Rest;
+    static REBCNT Num_Markers; // markers in the current job, including main
+    static REBCNT Idle_Markers;
+    static REBCNT Finished_Helpers;
+    static REBCNT Mark_Job;
+    static REBOOL Mark_Quit;
+
+    static void Grow_Mark_Buffer(void **buffer, REBCNT *rest, size_t wide)
+    {
+        REBCNT new_rest = (*rest == 0) ? 256 : *rest * 2;
+        void *p = realloc(*buffer, new_rest * wide);
+        if (p == NULL)
+            panic ("Out of memory for parallel GC marking");
+        *buffer = p;
+        *rest = new_rest;
+    }
+#endif
+
+
+// All setting of the mark bit on nodes goes through here, so that parallel
+// markers can race to set it with an atomic operation.  It returns TRUE if
+// the node was not already marked.
+//
+static inline REBOOL Set_Node_Marked(REBSER *s)
+{
+  #ifdef PARALLEL_MARKING
+    if (Marker != NULL) {
+        if (
+            __atomic_fetch_or(
+                &s->header.bits, NODE_FLAG_MARKED, __ATOMIC_RELAXED
+            ) & NODE_FLAG_MARKED
+        ){
+            return FALSE; // another marker (or this one) got here first
+        }
+        return TRUE;
+    }
+  #endif
+
+    if (s->header.bits & NODE_FLAG_MARKED)
+        return FALSE;
+
+    s->header.bits |= NODE_FLAG_MARKED;
+    return TRUE;
+}
+
+
+// Markers set mark bits with an atomic OR while others may be reading the
+// same header, so when marking in parallel all reads of a node's header go
+// through an atomic load.  (A plain read racing those writes is a data race
+// even when the flags it tests never change.)
+//
+static inline uintptr_t Marking_Header_Bits(REBNOD *n) {
+  #ifdef PARALLEL_MARKING
+    if (Marker != NULL)
+        return __atomic_load_n(&n->header.bits, __ATOMIC_RELAXED);
+  #endif
+    return n->header.bits;
+}
+
+#define MARKING_SER_FLAG(s,f) \
+    did (Marking_Header_Bits(NOD(s)) & (f))
+
+
+// Marking GOB! and EVENT! structs is not thread-safe, see Mark_Struct_Mutex
+//
+static inline void Lock_Struct_Marking(void) {
+  #ifdef PARALLEL_MARKING
+    if (Marker != NULL)
+        pthread_mutex_lock(&Mark_Struct_Mutex);
+  #endif
+}
+
+static inline void Unlock_Struct_Marking(void) {
+  #ifdef PARALLEL_MARKING
+    if (Marker != NULL)
+        pthread_mutex_unlock(&Mark_Struct_Mutex);
+  #endif
+}
+
+
 // Private routines for dealing with the GC mark bit.  Note that not all
 // REBSERs are actually series at the present time, because some are
 // "pairings".  Plus the name Mark_Rebser_Only helps drive home that it's
@@ -131,11 +304,7 @@ static inline void Mark_Rebser_Only(REBSER *s)
     }
   #endif
     assert(NOT_SER_FLAG(s, SERIES_FLAG_ARRAY));
-    s->header.bits |= NODE_FLAG_MARKED;
-}
-
-static inline REBOOL Is_Rebser_Marked_Or_Pending(REBSER *rebser) {
-    return did (rebser->header.bits & NODE_FLAG_MARKED);
+    Set_Node_Marked(s);
 }
 
 static inline REBOOL Is_Rebser_Marked(REBSER *rebser) {
@@ -183,10 +352,22 @@ static void Queue_Mark_Array_Subclass_Deep(REBARR *a)
     // have been marked yet--it could still be waiting in the queue.  But we
     // don't want to wastefully submit it to the queue multiple times.
     //
-    if (Is_Rebser_Marked_Or_Pending(SER(a)))
+    // (When marking in parallel, testing and setting the mark is atomic, so
+    // only one marker will queue the array.)
+    //
+    if (not Set_Node_Marked(SER(a))) // the up-front marking
         return;
 
-    SER(a)->header.bits |= NODE_FLAG_MARKED; // the up-front marking
+  #ifdef PARALLEL_MARKING
+    if (Marker != NULL) {
+        if (Marker->len == Marker->rest)
+            Grow_Mark_Buffer(
+                cast(void**, &Marker->stack), &Marker->rest, sizeof(REBARR*)
+            );
+        Marker->stack[Marker->len++] = a;
+        return;
+    }
+  #endif
 
     // Add series to the end of the mark stack series.  The length must be
     // maintained accurately to know when the stack needs to grow.
@@ -205,8 +386,8 @@ inline static void Queue_Mark_Array_Deep(REBARR *a) {
     assert(NOT_SER_FLAG(a, ARRAY_FLAG_PARAMLIST));
     assert(NOT_SER_FLAG(a, ARRAY_FLAG_PAIRLIST));
 
-    if (GET_SER_FLAG(a, ARRAY_FLAG_FILE_LINE))
-        LINK(a).file->header.bits |= NODE_FLAG_MARKED;
+    if (MARKING_SER_FLAG(a, ARRAY_FLAG_FILE_LINE))
+        Set_Node_Marked(SER(LINK(a).file));
 
     Queue_Mark_Array_Subclass_Deep(a);
 }
@@ -299,7 +480,7 @@ inline static void Queue_Mark_Binding_Deep(const RELVAL *v) {
     }
   #endif
 
-    if (NOT_CELL(binding))
+    if (not (Marking_Header_Bits(binding) & NODE_FLAG_CELL))
         Queue_Mark_Array_Subclass_Deep(ARR(binding));
 }
 
@@ -480,7 +661,7 @@ static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
             // data for the handle lives in that shared location.  There is
             // nothing the GC needs to see inside a handle.
             //
-            SER(singular)->header.bits |= NODE_FLAG_MARKED;
+            Set_Node_Marked(SER(singular));
 
         #if !defined(NDEBUG)
             assert(ARR_LEN(singular) == 1);
@@ -534,7 +715,7 @@ static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
         // process, as long as the bit is cleared at the end.
         //
         REBSER *pairing = cast(REBSER*, v->payload.pair);
-        pairing->header.bits |= NODE_FLAG_MARKED; // read via REBSER
+        Set_Node_Marked(pairing); // read via REBSER
         break; }
 
     case REB_TUPLE:
@@ -635,11 +816,15 @@ static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
         break; }
 
     case REB_GOB:
+        Lock_Struct_Marking();
         Queue_Mark_Gob_Deep(VAL_GOB(v));
+        Unlock_Struct_Marking();
         break;
 
     case REB_EVENT:
+        Lock_Struct_Marking();
         Queue_Mark_Event_Deep(v);
+        Unlock_Struct_Marking();
         break;
 
     case REB_STRUCT: {
@@ -672,7 +857,7 @@ static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
         //
         // Note this may be a singular array handle, or it could be a BINARY!
         //
-        if (GET_SER_FLAG(v->payload.structure.data, SERIES_FLAG_ARRAY))
+        if (MARKING_SER_FLAG(v->payload.structure.data, SERIES_FLAG_ARRAY))
             Queue_Mark_Singular_Array(ARR(v->payload.structure.data));
         else
             Mark_Rebser_Only(v->payload.structure.data);
@@ -716,177 +901,412 @@ inline static void Queue_Mark_Value_Deep(const RELVAL *v)
 
 
 //
-//  Propagate_All_GC_Marks: C
+//  Propagate_Marks_From: C
 //
-// The Mark Stack is a series containing series pointers.  They have already
-// had their SERIES_FLAG_MARK set to prevent being added to the stack multiple
-// times, but the items they can reach are not necessarily marked yet.
-//
-// Processing continues until all reachable items from the mark stack are
-// known to be marked.
+// Queue up everything reachable from the cells (and subclass-specific fields)
+// of an array which was taken off a mark stack.  The array itself should
+// already have been marked at queueing time.
 //
-static void Propagate_All_GC_Marks(void)
+static void Propagate_Marks_From(REBARR *a)
 {
-    assert(!in_mark);
+    // We should have marked this series at queueing time to keep it from
+    // being doubly added before the queue had a chance to be processed
+    //
+    assert(Is_Rebser_Marked(SER(a)));
 
-    while (SER_LEN(GC_Mark_Stack) != 0) {
-        SET_SERIES_LEN(GC_Mark_Stack, SER_LEN(GC_Mark_Stack) - 1); // still ok
+#ifdef HEAVY_CHECKS
+    //
+    // The GC is a good general hook point that all series which have been
+    // managed will go through, so it's a good time to assert properties
+    // about the array.
+    //
+    ASSERT_ARRAY(a);
+#else
+    //
+    // For a lighter check, make sure it's marked as a value-bearing array
+    // and that it hasn't been freed.
+    //
+    assert(GET_SER_FLAG(a, SERIES_FLAG_ARRAY));
+    assert(not IS_FREE_NODE(SER(a)));
+#endif
 
-        // Data pointer may change in response to an expansion during
-        // Mark_Array_Deep_Core(), so must be refreshed on each loop.
+    RELVAL *v = ARR_HEAD(a);
+
+    if (MARKING_SER_FLAG(a, ARRAY_FLAG_PARAMLIST)) {
+        assert(IS_ACTION(v));
+        assert(v->extra.binding == UNBOUND); // archetypes have no binding
+
+        // These queueings cannot be done in Queue_Mark_Function_Deep
+        // because of the potential for overflowing the C stack with calls
+        // to Queue_Mark_Function_Deep.
+
+        REBARR *body_holder = v->payload.action.body_holder;
+        Queue_Mark_Singular_Array(body_holder);
+
+        REBARR *facade = LINK(a).facade;
+        Queue_Mark_Array_Subclass_Deep(facade);
+
+        REBCTX *exemplar = LINK(body_holder).exemplar;
+        if (exemplar != NULL)
+            Queue_Mark_Context_Deep(exemplar);
+
+        REBCTX *meta = MISC(a).meta;
+        if (meta != NULL)
+            Queue_Mark_Context_Deep(meta);
+
+        ++v; // function archetype completely marked by this process
+    }
+    else if (MARKING_SER_FLAG(a, ARRAY_FLAG_VARLIST)) {
         //
-        REBARR *a = *SER_AT(REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack));
+        // Currently only FRAME! uses binding
+        //
+        assert(ANY_CONTEXT(v));
+        assert(v->extra.binding == UNBOUND or VAL_TYPE(v) == REB_FRAME);
 
-        // Termination is not required in the release build (the length is
-        // enough to know where it ends).  But overwrite with trash in debug.
+        // These queueings cannot be done in Queue_Mark_Context_Deep
+        // because of the potential for overflowing the C stack with calls
+        // to Queue_Mark_Context_Deep.
+
+        REBNOD *keysource = LINK(a).keysource;
+        if (Marking_Header_Bits(keysource) & NODE_FLAG_CELL) {
+            //
+            // Must be a FRAME! and it must be on the stack running.  If
+            // it has stopped running, then the keylist must be set to
+            // UNBOUND which would not be a cell.
+            //
+            // There's nothing to mark for GC since the frame is on the
+            // stack, which should preserve the function paramlist.
+            //
+            assert(IS_FRAME(v));
+        }
+        else {
+            REBARR *keylist = ARR(keysource);
+            if (IS_FRAME(v)) {
+                //
+                // Keylist is the "facade", it may not be a paramlist but
+                // it needs to be "paramlist shaped"...and the [0] element
+                // has to be an ACTION!.
+                //
+                assert(IS_ACTION(ARR_HEAD(keylist)));
+
+                // Frames use paramlists as their "keylist", there is no
+                // place to put an ancestor link.
+            }
+            else {
+                assert(NOT_SER_FLAG(keylist, ARRAY_FLAG_PARAMLIST));
+                ASSERT_UNREADABLE_IF_DEBUG(ARR_HEAD(keylist));
+
+                REBARR *ancestor = LINK(keylist).ancestor;
+                Queue_Mark_Array_Subclass_Deep(ancestor); // maybe keylist
+            }
+            Queue_Mark_Array_Subclass_Deep(keylist);
+        }
+
+        REBCTX *meta = MISC(a).meta;
+        if (meta != NULL)
+            Queue_Mark_Context_Deep(meta);
+
+        ++v; // context archtype completely marked by this process
+    }
+    else if (MARKING_SER_FLAG(a, ARRAY_FLAG_PAIRLIST)) {
         //
-        TRASH_POINTER_IF_DEBUG(
-            *SER_AT(REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack))
-        );
+        // There was once a "small map" optimization that wouldn't
+        // produce a hashlist for small maps and just did linear search.
+        // @giuliolunati deleted that for the time being because it
+        // seemed to be a source of bugs, but it may be added again...in
+        // which case the hashlist may be NULL.
+        //
+        REBSER *hashlist = LINK(a).hashlist;
+        assert(hashlist != NULL);
 
-        // We should have marked this series at queueing time to keep it from
-        // being doubly added before the queue had a chance to be processed
-         //
-        assert(Is_Rebser_Marked(SER(a)));
+        Mark_Rebser_Only(hashlist);
+    }
+    else if (MARKING_SER_FLAG(a, ARRAY_FLAG_KEYHASH)) {
+        //
+        // Big keylists have a table to find keys by canon, see notes on
+        // Update_Keyhash()
+        //
+        Mark_Rebser_Only(MISC(a).keyhash);
+    }
 
-    #ifdef HEAVY_CHECKS
+    if (GET_SER_INFO(a, SERIES_INFO_INACCESSIBLE)) {
         //
-        // The GC is a good general hook point that all series which have been
-        // managed will go through, so it's a good time to assert properties
-        // about the array.
+        // At present the only inaccessible arrays are expired frames of
+        // functions with stack-bound arg and local lifetimes.  They are
+        // just singular REBARRs with the FRAME! archetype value.
         //
-        ASSERT_ARRAY(a);
-    #else
+        assert(ALL_SER_FLAGS(a, ARRAY_FLAG_VARLIST | CONTEXT_FLAG_STACK));
+        assert(IS_FRAME(ARR_SINGLE(a)));
+        return;
+    }
+
+    for (; NOT_END(v); ++v) {
+        Queue_Mark_Opt_Value_Deep(v);
         //
-        // For a lighter check, make sure it's marked as a value-bearing array
-        // and that it hasn't been freed.
+    #if !defined(NDEBUG)
         //
-        assert(GET_SER_FLAG(a, SERIES_FLAG_ARRAY));
-        assert(not IS_FREE_NODE(SER(a)));
+        // Voids are illegal in most arrays, but the varlist of a context
+        // uses void values to denote that the variable is not set.  Also
+        // reified C va_lists as Do_Core() sources can have them, and the
+        // pairlist of a map has them for the values of removed keys.
+        //
+        if (
+            not IS_BLANK_RAW(v)
+            and IS_VOID(v)
+            and not GET_SER_FLAG(a, ARRAY_FLAG_VARLIST)
+            and not GET_SER_FLAG(a, ARRAY_FLAG_PAIRLIST)
+            and not GET_SER_FLAG(a, ARRAY_FLAG_VOIDS_LEGAL)
+        ){
+            panic(a);
+        }
     #endif
+    }
+}
 
-        RELVAL *v = ARR_HEAD(a);
-
-        if (GET_SER_FLAG(a, ARRAY_FLAG_PARAMLIST)) {
-            assert(IS_ACTION(v));
-            assert(v->extra.binding == UNBOUND); // archetypes have no binding
 
-            // These queueings cannot be done in Queue_Mark_Function_Deep
-            // because of the potential for overflowing the C stack with calls
-            // to Queue_Mark_Function_Deep.
+#ifdef PARALLEL_MARKING
 
-            REBARR *body_holder = v->payload.action.body_holder;
-            Queue_Mark_Singular_Array(body_holder);
+//
+//  Share_Marks: C
+//
+// Move the older half of a marker's stack to the shared list, where markers
+// which have run out of work can pick it up.
+//
+static void Share_Marks(struct Reb_Marker *m)
+{
+    REBCNT half = m->len / 2;
 
-            REBARR *facade = LINK(a).facade;
-            Queue_Mark_Array_Subclass_Deep(facade);
+    pthread_mutex_lock(&Mark_Mutex);
 
-            REBCTX *exemplar = LINK(body_holder).exemplar;
-            if (exemplar != NULL)
-                Queue_Mark_Context_Deep(exemplar);
+    while (Shared_Len + half > Shared_Rest)
+        Grow_Mark_Buffer(
+            cast(void**, &Shared_Marks), &Shared_Rest, sizeof(REBARR*)
+        );
+    memcpy(Shared_Marks + Shared_Len, m->stack, half * sizeof(REBARR*));
+    Shared_Len += half;
 
-            REBCTX *meta = MISC(a).meta;
-            if (meta != NULL)
-                Queue_Mark_Context_Deep(meta);
+    pthread_cond_broadcast(&Mark_Work_Cond);
+    pthread_mutex_unlock(&Mark_Mutex);
 
-            ++v; // function archetype completely marked by this process
-        }
-        else if (GET_SER_FLAG(a, ARRAY_FLAG_VARLIST)) {
-            //
-            // Currently only FRAME! uses binding
-            //
-            assert(ANY_CONTEXT(v));
-            assert(v->extra.binding == UNBOUND or VAL_TYPE(v) == REB_FRAME);
+    memmove(m->stack, m->stack + half, (m->len - half) * sizeof(REBARR*));
+    m->len -= half;
+}
 
-            // These queueings cannot be done in Queue_Mark_Context_Deep
-            // because of the potential for overflowing the C stack with calls
-            // to Queue_Mark_Context_Deep.
 
-            REBNOD *keysource = LINK(a).keysource;
-            if (IS_CELL(keysource)) {
-                //
-                // Must be a FRAME! and it must be on the stack running.  If
-                // it has stopped running, then the keylist must be set to
-                // UNBOUND which would not be a cell.
-                //
-                // There's nothing to mark for GC since the frame is on the
-                // stack, which should preserve the function paramlist.
-                //
-                assert(IS_FRAME(v));
-            }
-            else {
-                REBARR *keylist = ARR(keysource);
-                if (IS_FRAME(v)) {
-                    //
-                    // Keylist is the "facade", it may not be a paramlist but
-                    // it needs to be "paramlist shaped"...and the [0] element
-                    // has to be an ACTION!.
-                    //
-                    assert(IS_ACTION(ARR_HEAD(keylist)));
+//
+//  Run_Marker: C
+//
+// Work loop of a marker in a parallel job (the main thread is marker 0).
+// When a marker has nothing on its own stack it takes from the shared list,
+// or waits.  The job is over when every marker is waiting with nothing
+// shared, as nothing is left that could queue more work.
+//
+static void Run_Marker(struct Reb_Marker *m)
+{
+    Marker = m;
 
-                    // Frames use paramlists as their "keylist", there is no
-                    // place to put an ancestor link.
-                }
-                else {
-                    assert(NOT_SER_FLAG(keylist, ARRAY_FLAG_PARAMLIST));
-                    ASSERT_UNREADABLE_IF_DEBUG(ARR_HEAD(keylist));
+    while (TRUE) {
+        while (m->len != 0) {
+            REBARR *a = m->stack[--m->len];
+            Propagate_Marks_From(a);
 
-                    REBARR *ancestor = LINK(keylist).ancestor;
-                    Queue_Mark_Array_Subclass_Deep(ancestor); // maybe keylist
-                }
-                Queue_Mark_Array_Subclass_Deep(keylist);
+            if (
+                m->len > MARK_SHARE_THRESHOLD
+                and __atomic_load_n(&Idle_Markers, __ATOMIC_RELAXED) != 0
+            ){
+                Share_Marks(m);
             }
+        }
 
-            REBCTX *meta = MISC(a).meta;
-            if (meta != NULL)
-                Queue_Mark_Context_Deep(meta);
+        pthread_mutex_lock(&Mark_Mutex);
+        __atomic_add_fetch(&Idle_Markers, 1, __ATOMIC_RELAXED);
 
-            ++v; // context archtype completely marked by this process
-        }
-        else if (GET_SER_FLAG(a, ARRAY_FLAG_PAIRLIST)) {
-            //
-            // There was once a "small map" optimization that wouldn't
-            // produce a hashlist for small maps and just did linear search.
-            // @giuliolunati deleted that for the time being because it
-            // seemed to be a source of bugs, but it may be added again...in
-            // which case the hashlist may be NULL.
-            //
-            REBSER *hashlist = LINK(a).hashlist;
-            assert(hashlist != NULL);
+        while (Shared_Len == 0 and Idle_Markers != Num_Markers)
+            pthread_cond_wait(&Mark_Work_Cond, &Mark_Mutex);
 
-            Mark_Rebser_Only(hashlist);
+        if (Shared_Len == 0) { // all idle, marking is complete
+            pthread_cond_broadcast(&Mark_Work_Cond);
+            pthread_mutex_unlock(&Mark_Mutex);
+            break;
         }
 
-        if (GET_SER_INFO(a, SERIES_INFO_INACCESSIBLE)) {
-            //
-            // At present the only inaccessible arrays are expired frames of
-            // functions with stack-bound arg and local lifetimes.  They are
-            // just singular REBARRs with the FRAME! archetype value.
-            //
-            assert(ALL_SER_FLAGS(a, ARRAY_FLAG_VARLIST | CONTEXT_FLAG_STACK));
-            assert(IS_FRAME(ARR_SINGLE(a)));
+        __atomic_sub_fetch(&Idle_Markers, 1, __ATOMIC_RELAXED);
+
+        REBCNT take = (Shared_Len + 1) / 2;
+        while (m->len + take > m->rest)
+            Grow_Mark_Buffer(
+                cast(void**, &m->stack), &m->rest, sizeof(REBARR*)
+            );
+        Shared_Len -= take;
+        memcpy(
+            m->stack + m->len, Shared_Marks + Shared_Len,
+            take * sizeof(REBARR*)
+        );
+        m->len += take;
+
+        pthread_mutex_unlock(&Mark_Mutex);
+    }
+
+    Marker = NULL;
+}
+
+
+//
+//  Mark_Helper_Thread: C
+//
+// Helper threads are started on demand, and then wait for each parallel
+// marking job.  Helpers past the count requested for a job sit it out.
+//
+static void *Mark_Helper_Thread(void *arg)
+{
+    REBCNT index = cast(REBCNT, cast(uintptr_t, arg));
+    struct Reb_Marker *m = &Markers[index];
+
+    pthread_mutex_lock(&Mark_Mutex);
+    while (TRUE) {
+        while (m->job == Mark_Job and not Mark_Quit)
+            pthread_cond_wait(&Mark_Job_Cond, &Mark_Mutex);
+
+        if (Mark_Quit)
+            break;
+
+        m->job = Mark_Job;
+        if (index >= Num_Markers)
             continue;
+
+        pthread_mutex_unlock(&Mark_Mutex);
+        Run_Marker(m);
+        pthread_mutex_lock(&Mark_Mutex);
+
+        ++Finished_Helpers;
+        pthread_cond_signal(&Mark_Done_Cond);
+    }
+    pthread_mutex_unlock(&Mark_Mutex);
+
+    return NULL;
+}
+
+
+//
+//  Propagate_All_GC_Marks_Parallel: C
+//
+// Hand the arrays pending on GC_Mark_Stack out to the main thread and the
+// helper threads, and return once they have all been propagated.
+//
+static void Propagate_All_GC_Marks_Parallel(void)
+{
+    REBCNT helpers = MIN(GC_Mark_Helpers, MAX_MARK_HELPERS);
+
+    while (Num_Mark_Threads < helpers) {
+        REBCNT index = Num_Mark_Threads + 1;
+        Markers[index].job = Mark_Job; // only the main thread changes it
+        if (0 != pthread_create(
+            &Mark_Threads[Num_Mark_Threads],
+            NULL,
+            &Mark_Helper_Thread,
+            cast(void*, cast(uintptr_t, index))
+        )){
+            break; // just use the helpers that could be started
         }
+        ++Num_Mark_Threads;
+    }
+    helpers = MIN(helpers, Num_Mark_Threads);
 
-        for (; NOT_END(v); ++v) {
-            Queue_Mark_Opt_Value_Deep(v);
-            //
-        #if !defined(NDEBUG)
-            //
-            // Voids are illegal in most arrays, but the varlist of a context
-            // uses void values to denote that the variable is not set.  Also
-            // reified C va_lists as Do_Core() sources can have them.
-            //
-            if (
-                not IS_BLANK_RAW(v)
-                and IS_VOID(v)
-                and not GET_SER_FLAG(a, ARRAY_FLAG_VARLIST)
-                and not GET_SER_FLAG(a, ARRAY_FLAG_VOIDS_LEGAL)
-            ){
-                panic(a);
-            }
-        #endif
+    pthread_mutex_lock(&Mark_Mutex);
+
+    REBCNT len = SER_LEN(GC_Mark_Stack);
+    while (Shared_Len + len > Shared_Rest)
+        Grow_Mark_Buffer(
+            cast(void**, &Shared_Marks), &Shared_Rest, sizeof(REBARR*)
+        );
+    memcpy(
+        Shared_Marks + Shared_Len,
+        SER_HEAD(REBARR*, GC_Mark_Stack),
+        len * sizeof(REBARR*)
+    );
+    Shared_Len += len;
+    SET_SERIES_LEN(GC_Mark_Stack, 0);
+
+    Num_Markers = helpers + 1;
+    Idle_Markers = 0;
+    Finished_Helpers = 0;
+    ++Mark_Job;
+    pthread_cond_broadcast(&Mark_Job_Cond);
+
+    pthread_mutex_unlock(&Mark_Mutex);
+
+    Run_Marker(&Markers[0]);
+
+    pthread_mutex_lock(&Mark_Mutex);
+    while (Finished_Helpers != helpers)
+        pthread_cond_wait(&Mark_Done_Cond, &Mark_Mutex);
+    pthread_mutex_unlock(&Mark_Mutex);
+}
+
+
+//
+//  Shutdown_Mark_Helpers: C
+//
+static void Shutdown_Mark_Helpers(void)
+{
+    pthread_mutex_lock(&Mark_Mutex);
+    Mark_Quit = TRUE;
+    pthread_cond_broadcast(&Mark_Job_Cond);
+    pthread_mutex_unlock(&Mark_Mutex);
+
+    REBCNT n;
+    for (n = 0; n < Num_Mark_Threads; ++n)
+        pthread_join(Mark_Threads[n], NULL);
+    Num_Mark_Threads = 0;
+
+    for (n = 0; n <= MAX_MARK_HELPERS; ++n)
+        free(Markers[n].stack);
+    free(Shared_Marks);
+}
+
+#endif
+
+
+//
+//  Propagate_All_GC_Marks: C
+//
+// The Mark Stack is a series containing series pointers.  They have already
+// had their SERIES_FLAG_MARK set to prevent being added to the stack multiple
+// times, but the items they can reach are not necessarily marked yet.
+//
+// Processing continues until all reachable items from the mark stack are
+// known to be marked.
+//
+static void Propagate_All_GC_Marks(void)
+{
+    assert(!in_mark);
+
+    while (SER_LEN(GC_Mark_Stack) != 0) {
+      #ifdef PARALLEL_MARKING
+        if (
+            GC_Mark_Helpers != 0
+            and SER_LEN(GC_Mark_Stack) >= MARK_PARALLEL_THRESHOLD
+        ){
+            Propagate_All_GC_Marks_Parallel();
+            break;
         }
+      #endif
+
+        SET_SERIES_LEN(GC_Mark_Stack, SER_LEN(GC_Mark_Stack) - 1); // still ok
+
+        // Data pointer may change in response to an expansion during
+        // Mark_Array_Deep_Core(), so must be refreshed on each loop.
+        //
+        REBARR *a = *SER_AT(REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack));
+
+        // Termination is not required in the release build (the length is
+        // enough to know where it ends).  But overwrite with trash in debug.
+        //
+        TRASH_POINTER_IF_DEBUG(
+            *SER_AT(REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack))
+        );
+
+        Propagate_Marks_From(a);
     }
 }
 
@@ -938,75 +1358,69 @@ static void Reify_Any_C_Valist_Frames(void)
 // checks to see if their lifetime was dependent on a FRAME!.  If so, it
 // will free the node.  Otherwise, it will mark its dependencies.
 //
-// !!! This implementation walks over *all* the nodes.  Conceivably API roots
-// could be in their own pool.  They also wouldn't have to be REBSER nodes
-// at all.  Review.
+// The roots are enumerated from the GC_Roots table, so this is proportional
+// to the number of live API handles, not to the number of series.
 //
 static void Mark_Root_Series(void)
 {
-    REBSEG *seg;
-    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
-        REBSER *s = cast(REBSER *, seg + 1);
-        REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
-            //
-            // !!! A smarter switch statement here could do this more
-            // optimally...see the sweep code for an example.
-            //
-            if (IS_FREE_NODE(s))
-                continue;
-            if (not (s->header.bits & NODE_FLAG_ROOT))
-                continue;
+    // Walk backwards, because freeing a handle moves the last entry of the
+    // table into the freed one's slot (and that entry was already visited).
+    //
+    REBCNT n;
+    for (n = SER_LEN(GC_Roots); n > 0; --n) {
+        REBARR *a = *SER_AT(REBARR*, GC_Roots, n - 1);
+        REBSER *s = SER(a);
 
-            assert(not (s->info.bits & SERIES_INFO_HAS_DYNAMIC));
+        assert(s->header.bits & NODE_FLAG_ROOT);
+        assert(MISC(a).root_index == n - 1);
+        assert(not (s->info.bits & SERIES_INFO_HAS_DYNAMIC));
 
-            // API nodes are referenced from C code, they should never wind
-            // up referenced from values.  Marking another root should not
-            // be able to mark these handles.
-            //
-            assert(not (s->header.bits & NODE_FLAG_MARKED));
-
-            if (GET_SER_FLAG(s, NODE_FLAG_MANAGED)) {
-                if (GET_SER_INFO(LINK(s).owner, SERIES_INFO_INACCESSIBLE)) {
-                    if (NOT_SER_INFO(LINK(s).owner, FRAME_INFO_FAILED)) {
-                        //
-                        // Long term, it is likely that implicit managed-ness
-                        // will allow users to leak API handles.  It will
-                        // always be more efficient to not do that, so having
-                        // the code be strict for now is better.
-                        //
-                      #if !defined(NDEBUG)
-                        printf("handle not rebReleased(), not legal ATM\n");
-                      #endif
-                        panic (s);
-                    }
-
-                    GC_Kill_Series(s);
-                    continue;
+        // API nodes are referenced from C code, they should never wind
+        // up referenced from values.  Marking another root should not
+        // be able to mark these handles.
+        //
+        assert(not (s->header.bits & NODE_FLAG_MARKED));
+
+        if (GET_SER_FLAG(s, NODE_FLAG_MANAGED)) {
+            if (GET_SER_INFO(LINK(s).owner, SERIES_INFO_INACCESSIBLE)) {
+                if (NOT_SER_INFO(LINK(s).owner, FRAME_INFO_FAILED)) {
+                    //
+                    // Long term, it is likely that implicit managed-ness
+                    // will allow users to leak API handles.  It will
+                    // always be more efficient to not do that, so having
+                    // the code be strict for now is better.
+                    //
+                  #if !defined(NDEBUG)
+                    printf("handle not rebReleased(), not legal ATM\n");
+                  #endif
+                    panic (s);
                 }
 
-                // Since the frame is still alive, we should not have to mark
-                // it (it's on the stack and marked in the stack walk).
-                //
-                // But since this node is managed, currently this has to mark
-                // the node as in use else it will be freed in Sweep_Series()
-                //
-                s->header.bits |= NODE_FLAG_MARKED;
+                Remove_Api_Root(a);
+                GC_Kill_Series(s);
+                continue;
             }
 
-            // Pick up the dependencies deeply.  Note that ENDs are allowed
-            // because for instance, a DO might be executed with the API value
-            // as the OUT slot (since it is memory guaranteed not to relocate)
+            // Since the frame is still alive, we should not have to mark
+            // it (it's on the stack and marked in the stack walk).
             //
-            RELVAL *v = ARR_SINGLE(ARR(s));
-            if (NOT_END(v)) {
-              #ifdef DEBUG_UNREADABLE_BLANKS
-                if (not IS_UNREADABLE_DEBUG(v))
-              #endif
-                    if (not IS_VOID(v))
-                        Queue_Mark_Value_Deep(v);
-            }
+            // But since this node is managed, currently this has to mark
+            // the node as in use else it will be freed in Sweep_Series()
+            //
+            Set_Node_Marked(s);
+        }
 
+        // Pick up the dependencies deeply.  Note that ENDs are allowed
+        // because for instance, a DO might be executed with the API value
+        // as the OUT slot (since it is memory guaranteed not to relocate)
+        //
+        RELVAL *v = ARR_SINGLE(a);
+        if (NOT_END(v)) {
+          #ifdef DEBUG_UNREADABLE_BLANKS
+            if (not IS_UNREADABLE_DEBUG(v))
+          #endif
+                if (not IS_VOID(v))
+                    Queue_Mark_Value_Deep(v);
         }
     }
 
@@ -1309,14 +1723,69 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Relink_Free_Node: C
+//
+// Sweeps rebuild the SER_POOL free list in address order as they go, and
+// they keep the pool's count of free nodes in step with the list.
+//
+static inline void Relink_Free_Node(REBNOD *node)
+{
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+
+    node->next_if_free = NULL;
+    if (pool->last == NULL) {
+        assert(pool->first == NULL);
+        pool->first = node;
+    }
+    else
+        pool->last->next_if_free = node;
+    pool->last = node;
+
+    ++pool->free;
+}
+
+
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
+//  Kill_Needs_Safe_Point: C
+//
+// Would freeing this dead series run more than the pool code?  See the notes
+// on lazy sweeping at the top of the file.
+//
+static REBOOL Kill_Needs_Safe_Point(REBSER *s)
+{
+    if (GET_SER_INFO(s, SERIES_INFO_SAMPLED))
+        return TRUE; // Unsample_Series() updates the profiler's tables
+
+    if (
+        NOT_SER_FLAG(s, SERIES_FLAG_ARRAY)
+        or GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)
+    ){
+        return FALSE;
+    }
+
+    RELVAL *v = ARR_HEAD(ARR(s));
+    return did (
+        NOT_END(v)
+        and VAL_TYPE_RAW(v) == REB_HANDLE
+        and v->extra.singular == ARR(s)
+        and MISC(s).cleaner != NULL
+    );
+}
+
+
+//
+//  Sweep_Segment: C
+//
+// Scans all series nodes (REBSER structs) in a segment that is part of the
+// SER_POOL.  If a series had its lifetime management delegated to the
 // garbage collector with MANAGE_SERIES(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+// live during the marking phase then free it.  Free nodes are relinked into
+// the pool's free list.
 //
-static REBCNT Sweep_Series(void)
+// If the sweep is being done `lazily` (by an allocation), the dead series
+// that Kill_Needs_Safe_Point() are left for Finish_Series_Sweep() to free.
+//
+static REBCNT Sweep_Segment(REBSEG *seg, REBOOL lazily)
 {
     REBCNT count = 0;
 
@@ -1329,96 +1798,120 @@ static REBCNT Sweep_Series(void)
         and (NODE_FLAG_NODE == FLAGIT_LEFT(0)) // 0x8 after right shift
     );
 
-    REBSEG *seg;
-    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
-        REBSER *s = cast(REBSER*, seg + 1);
-        REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
-            switch (LEFT_N_BITS(s->header.bits, 4)) {
-            case 0:
-            case 1: // 0x1
-            case 2: // 0x2
-            case 3: // 0x2 + 0x1
-            case 4: // 0x4
-            case 5: // 0x4 + 0x1
-            case 6: // 0x4 + 0x2
-            case 7: // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (s);
+    REBSER *s = cast(REBSER*, seg + 1);
+    REBCNT n;
+    for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        switch (LEFT_N_BITS(s->header.bits, 4)) {
+        case 0:
+        case 1: // 0x1
+        case 2: // 0x2
+        case 3: // 0x2 + 0x1
+        case 4: // 0x4
+        case 5: // 0x4 + 0x1
+        case 6: // 0x4 + 0x2
+        case 7: // 0x4 + 0x2 + 0x1
+            //
+            // NODE_FLAG_NODE (0x8) is clear.  This signature is
+            // reserved for UTF-8 strings (corresponding to valid ASCII
+            // values in the first byte).
+            //
+            panic (s);
 
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+        // v-- Everything below here has NODE_FLAG_NODE set (0x8)
 
-            case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                // !!! Are there actually legitimate reasons to do this with
-                // arrays, where the creator knows the cells do not need
-                // GC protection?  Should finding an array in this state be
-                // considered a problem (e.g. the GC ran when you thought it
-                // couldn't run yet, hence would be able to free the array?)
-                //
-                break;
+        case 8:
+            // 0x8: unmanaged and unmarked, e.g. a series that was made
+            // with Make_Series() and hasn't been managed.  It doesn't
+            // participate in the GC.  Leave it as is.
+            //
+            // !!! Are there actually legitimate reasons to do this with
+            // arrays, where the creator knows the cells do not need
+            // GC protection?  Should finding an array in this state be
+            // considered a problem (e.g. the GC ran when you thought it
+            // couldn't run yet, hence would be able to free the array?)
+            //
+            break;
 
-            case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (s);
+        case 9:
+            // 0x8 + 0x1: marked but not managed, this can't happen,
+            // because the marking itself asserts nodes are managed.
+            //
+            panic (s);
 
-            case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (s->header.bits & NODE_FLAG_CELL) {
-                    assert(not (s->header.bits & NODE_FLAG_ROOT));
-                    Free_Node(SER_POOL, s); // Free_Pairing is for manuals
-                }
-                else
-                    GC_Kill_Series(s);
-                ++count;
+        case 10:
+            // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+            //
+            // !!! It would be nice if we could have NODE_FLAG_CELL here
+            // as part of the switch, but see its definition for why it
+            // is at position 8 from left and not an earlier bit.
+            //
+            if (s->header.bits & NODE_FLAG_CELL) {
+                assert(not (s->header.bits & NODE_FLAG_ROOT));
+                Free_Node(SER_POOL, s); // Free_Pairing is for manuals
+                ++GC_Nodes_Freed;
+                GC_Bytes_Freed += sizeof(REBSER);
+            }
+            else if (lazily and Kill_Needs_Safe_Point(s)) {
+                s->header.bits |= NODE_FLAG_MARKED; // later sweeps skip it
+                if (SER_FULL(GC_Sweep_Deferred))
+                    Extend_Series(GC_Sweep_Deferred, 8);
+                *SER_AT(REBSER*, GC_Sweep_Deferred, SER_LEN(GC_Sweep_Deferred))
+                    = s;
+                SET_SERIES_LEN(
+                    GC_Sweep_Deferred, SER_LEN(GC_Sweep_Deferred) + 1
+                );
                 break;
+            }
+            else
+                GC_Kill_Series(s);
+            Relink_Free_Node(NOD(s));
+            ++count;
+            break;
 
-            case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                s->header.bits &= ~NODE_FLAG_MARKED;
-                break;
+        case 11:
+            // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+            // Don't GC it, just clear the mark.
+            //
+            s->header.bits &= ~NODE_FLAG_MARKED;
+            break;
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
+        // v-- Everything below this line has the two leftmost bits set
+        // in the header.  In the *general* case this could be a valid
+        // first byte of a multi-byte sequence in UTF-8...so only the
+        // special bit pattern of the free case uses this.
 
-            case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(LEFT_8_BITS(s->header.bits) == FREED_SERIES_BYTE);
-                break;
+        case 12:
+            // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+            //
+            assert(LEFT_8_BITS(s->header.bits) == FREED_SERIES_BYTE);
+            Relink_Free_Node(NOD(s));
+            break;
 
-            case 13:
-            case 14:
-            case 15:
-                panic (s); // 0x8 + 0x4 + ... reserved for UTF-8
-            }
+        case 13:
+        case 14:
+        case 15:
+            panic (s); // 0x8 + 0x4 + ... reserved for UTF-8
         }
     }
 
-    // For efficiency of memory use, REBSER is nominally defined as
-    // 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
-    // that might make the cells a size greater than REBSER size require
-    // doing pairings in a different pool.
-    //
+    return count;
+}
+
+
+//
+//  Sweep_Pairings: C
+//
+// For efficiency of memory use, REBSER is nominally defined as
+// 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
+// that might make the cells a size greater than REBSER size require
+// doing pairings in a different pool.  That pool is always swept at once.
+//
+static REBCNT Sweep_Pairings(void)
+{
+    REBCNT count = 0;
+
   #ifdef UNUSUAL_REBVAL_SIZE
+    REBSEG *seg;
     for (seg = Mem_Pools[PAR_POOL].segs; seg != NULL; seg = seg->next) {
         REBVAL *v = cast(REBVAL*, seg + 1);
         if (v->header.bits & NODE_FLAG_FREE) {
@@ -1434,6 +1927,8 @@ static REBCNT Sweep_Series(void)
                 v->header.bits &= ~NODE_FLAG_MARKED;
             else {
                 Free_Node(PAR_POOL, v); // Free_Pairing is for manuals
+                ++GC_Nodes_Freed;
+                GC_Bytes_Freed += 2 * sizeof(REBVAL);
                 ++count;
             }
         }
@@ -1444,6 +1939,141 @@ static REBCNT Sweep_Series(void)
 }
 
 
+//
+//  Start_Series_Sweep: C
+//
+// Empty the SER_POOL free list, and make all of its segments due to be swept.
+// Segments added by Fill_Pool() while the sweep is pending go on the front
+// of the segment list, so they won't be reached by it.
+//
+static void Start_Series_Sweep(void)
+{
+    assert(GC_Sweep_Seg == NULL and SER_LEN(GC_Sweep_Keeps) == 0);
+
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    pool->first = NULL;
+    pool->last = NULL;
+    pool->free = 0;
+
+    GC_Sweep_Seg = pool->segs;
+}
+
+
+//
+//  Unmark_Sweep_Keeps: C
+//
+// Clear the marks of series that were kept alive by becoming managed during
+// the sweep, once there are no segments left for it to sweep.
+//
+static void Unmark_Sweep_Keeps(void)
+{
+    assert(GC_Sweep_Seg == NULL);
+
+    REBSER **kept = SER_HEAD(REBSER*, GC_Sweep_Keeps);
+    REBCNT n;
+    for (n = SER_LEN(GC_Sweep_Keeps); n > 0; --n, ++kept)
+        (*kept)->header.bits &= ~NODE_FLAG_MARKED;
+    SET_SERIES_LEN(GC_Sweep_Keeps, 0);
+}
+
+
+//
+//  Sweep_Series_Lazily: C
+//
+// Called by Make_Node() when the SER_POOL runs out of free nodes while a
+// sweep is pending.  Sweeps segments until one yields a free node.
+//
+REBCNT Sweep_Series_Lazily(void)
+{
+    assert(GC_Sweep_Seg != NULL and not GC_Sweeping);
+
+    REBCNT count = 0;
+
+    GC_Sweeping = TRUE;
+    while (GC_Sweep_Seg != NULL and Mem_Pools[SER_POOL].first == NULL) {
+        count += Sweep_Segment(GC_Sweep_Seg, TRUE);
+        GC_Sweep_Seg = GC_Sweep_Seg->next; // after, see Free_Node()
+    }
+    GC_Sweeping = FALSE;
+
+    if (GC_Sweep_Seg == NULL)
+        Unmark_Sweep_Keeps(); // but GC_Sweep_Deferred waits for a safe point
+
+    return count;
+}
+
+
+//
+//  Finish_Series_Sweep: C
+//
+// Sweep any segments still due, and free the dead series that sweeps done
+// by allocations left for a safe point.  Must be called where running a
+// HANDLE!'s cleaner is allowed.
+//
+REBCNT Finish_Series_Sweep(void)
+{
+    assert(not GC_Sweeping);
+
+    REBCNT count = 0;
+
+    if (GC_Sweep_Seg != NULL) {
+        GC_Sweeping = TRUE;
+        while (GC_Sweep_Seg != NULL) {
+            count += Sweep_Segment(GC_Sweep_Seg, FALSE);
+            GC_Sweep_Seg = GC_Sweep_Seg->next;
+        }
+        GC_Sweeping = FALSE;
+
+        Unmark_Sweep_Keeps();
+    }
+
+    REBSER **deferred = SER_HEAD(REBSER*, GC_Sweep_Deferred);
+    REBCNT n;
+    for (n = SER_LEN(GC_Sweep_Deferred); n > 0; --n, ++deferred) {
+        GC_Kill_Series(*deferred);
+        ++count;
+    }
+    SET_SERIES_LEN(GC_Sweep_Deferred, 0);
+
+    return count;
+}
+
+
+//
+//  Keep_Series_From_Sweep: C
+//
+// A series which becomes managed while a sweep is pending might be in a
+// segment that hasn't been swept, and would look like garbage to it.
+//
+void Keep_Series_From_Sweep(REBSER *s)
+{
+    assert(GC_Sweep_Seg != NULL and IS_SERIES_MANAGED(s));
+
+    if (s->header.bits & NODE_FLAG_MARKED)
+        return;
+
+    s->header.bits |= NODE_FLAG_MARKED;
+
+    if (SER_FULL(GC_Sweep_Keeps))
+        Extend_Series(GC_Sweep_Keeps, 8);
+    *SER_AT(REBSER*, GC_Sweep_Keeps, SER_LEN(GC_Sweep_Keeps)) = s;
+    SET_SERIES_LEN(GC_Sweep_Keeps, SER_LEN(GC_Sweep_Keeps) + 1);
+}
+
+
+//
+//  Sweep_Series: C
+//
+// Sweep all of the series nodes at once, returning how many were freed.
+//
+static REBCNT Sweep_Series(void)
+{
+    Start_Series_Sweep();
+    REBCNT count = Finish_Series_Sweep();
+    return count + Sweep_Pairings();
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -1500,14 +2130,101 @@ REBCNT Fill_Sweeplist(REBSER *sweeplist)
 
 
 //
-//  Recycle_Core: C
+//  Adapt_Ballast: C
 //
-// Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
-// to be a series whose width is sizeof(REBSER*), and it will be filled with
-// the list of series that *would* be recycled.
+// Choose how many bytes may be allocated before the next automatic recycle,
+// based on how much memory is in use after a full recycle.  Memory in use
+// is what has been allocated minus the free nodes in the pools (a lazy sweep
+// hasn't found its free nodes yet, so it overestimates in that case).
 //
-REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
+static void Adapt_Ballast(void)
+{
+    REBU64 live = PG_Mem_Usage;
+
+    REBCNT pool_num;
+    for (pool_num = 0; pool_num < SYSTEM_POOL; ++pool_num) {
+        REBPOL *pool = &Mem_Pools[pool_num];
+        live -= cast(REBU64, pool->free) * pool->wide;
+    }
+    GC_Live_Bytes = live;
+
+    if (GC_Fixed_Ballast or PG_Boot_Phase < BOOT_ERRORS)
+        return; // (SYSTEM/OPTIONS may not be there yet during boot)
+
+    REBI64 min = Get_System_Int(SYS_OPTIONS, OPTIONS_GC_MIN_BALLAST, 0);
+    REBI64 max = Get_System_Int(SYS_OPTIONS, OPTIONS_GC_MAX_BALLAST, 0);
+    if (min <= 0)
+        min = MEM_BALLAST;
+    if (max <= 0 or max > INT32_MAX) // GC_Ballast is only 32-bit
+        max = INT32_MAX;
+    if (min > max)
+        min = max;
+
+    REBDEC growth;
+    REBVAL *opt = Get_System(SYS_OPTIONS, OPTIONS_GC_GROWTH);
+    if (IS_DECIMAL(opt))
+        growth = VAL_DECIMAL(opt);
+    else if (IS_INTEGER(opt))
+        growth = cast(REBDEC, VAL_INT64(opt));
+    else
+        growth = 1.0; // e.g. BLANK!, just use the minimum
+
+    REBDEC ballast = cast(REBDEC, live) * (growth - 1.0);
+    if (ballast < min)
+        TG_Ballast = min;
+    else if (ballast > max)
+        TG_Ballast = max;
+    else
+        TG_Ballast = cast(REBI64, ballast);
+}
+
+
+//
+//  Split_GC_Time: C
+//
+// Add the microseconds since *split to a phase's total, and restart *split
+// for the next phase.
+//
+static void Split_GC_Time(REBI64 *total, REBI64 *split)
 {
+    REBI64 now = OS_DELTA_TIME(0);
+    *total += now - *split;
+    *split = now;
+}
+
+
+//
+//  Note_GC_Pause: C
+//
+// Count a recycle in the bucket of GC_Pauses its pause time falls into.
+// The buckets go up by factors of 10 from 100 microseconds.
+//
+static void Note_GC_Pause(REBI64 usecs)
+{
+    REBCNT bucket = 0;
+    REBI64 limit = 100;
+    while (bucket < GC_PAUSE_BUCKETS - 1 and usecs >= limit) {
+        ++bucket;
+        limit *= 10;
+    }
+    ++GC_Pauses[bucket];
+}
+
+
+//
+//  Recycle_Maybe_Lazy: C
+//
+// Shared implementation of eager and lazy recycles.  A lazy recycle marks
+// the same way, but leaves the sweep to be done by allocations (its count is
+// then only the dead interned strings).
+//
+static REBCNT Recycle_Maybe_Lazy(
+    REBOOL shutdown,
+    REBOOL lazy,
+    REBSER *sweeplist
+){
+    assert(not lazy or (not shutdown and sweeplist == NULL));
+
     // Ordinarily, it should not be possible to spawn a recycle during a
     // recycle.  But when debug code is added into the recycling code, it
     // could cause a recursion.  Be tolerant of such recursions to make that
@@ -1529,9 +2246,22 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
         return 0;
     }
 
-#if !defined(NDEBUG)
+    // Host services may be gone by the time of the shutdown recycle, so it
+    // isn't timed.
+    //
+    REBI64 start_time = shutdown ? 0 : OS_DELTA_TIME(0);
+    REBI64 split = start_time;
+
+    // Marking has to start with no marks left over from the last recycle.
+    // Segments a lazy sweep hasn't reached yet are swept now, and that is
+    // part of this recycle's pause--so it counts as sweep time.  (Segments
+    // swept by allocations in between recycles are not timed.)
+    //
+    REBCNT count = Finish_Series_Sweep();
+    if (not shutdown)
+        Split_GC_Time(&GC_Sweep_Time, &split);
+
     GC_Recycling = TRUE;
-#endif
 
     ASSERT_NO_GC_MARKS_PENDING();
 
@@ -1566,20 +2296,21 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
         Mark_Data_Stack();
 
         Mark_Guarded_Nodes();
+        Split_GC_Time(&GC_Root_Time, &split);
 
         Mark_Frame_Stack_Deep();
+        Split_GC_Time(&GC_Stack_Time, &split);
 
         Propagate_All_GC_Marks();
 
         Mark_Devices_Deep();
+        Split_GC_Time(&GC_Propagate_Time, &split);
     }
 
     // SWEEPING PHASE
 
     ASSERT_NO_GC_MARKS_PENDING();
 
-    REBCNT count = 0;
-
     if (sweeplist != NULL) {
     #if defined(NDEBUG)
         panic (sweeplist);
@@ -1587,6 +2318,11 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
         count += Fill_Sweeplist(sweeplist);
     #endif
     }
+    else if (lazy) {
+        count += Sweep_Dead_Interns();
+        Start_Series_Sweep();
+        count += Sweep_Pairings();
+    }
     else
         count += Sweep_Series();
 
@@ -1597,6 +2333,9 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
     //
     Sweep_Gobs();
 
+    if (not shutdown)
+        Split_GC_Time(&GC_Sweep_Time, &split);
+
 #if !defined(NDEBUG)
     // Compute new stats:
     PG_Reb_Stats->Recycle_Series
@@ -1634,22 +2373,66 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
             TG_Ballast = INT32_MAX;
         }*/
 
+        Adapt_Ballast();
         GC_Ballast = TG_Ballast;
 
+        // Allocations made by the recycle itself (e.g. in gathering the dead
+        // interned strings) may have signaled for another one, but that is
+        // moot now that the ballast has been reset.
+        //
+        CLR_SIGNAL(SIG_RECYCLE);
+
+        // Give pool segments back to the OS if a burst of allocation has
+        // left a lot of them empty.
+        //
+        Compact_Pools(FALSE);
+
+        REBI64 pause = OS_DELTA_TIME(start_time);
+        Note_GC_Pause(pause);
+
+        ++GC_Recycles;
+        GC_Pause_Time += pause;
+
         if (Reb_Opts->watch_recycle)
             Debug_Fmt(RM_WATCH_RECYCLE, count);
     }
 
     ASSERT_NO_GC_MARKS_PENDING();
 
-#if !defined(NDEBUG)
     GC_Recycling = FALSE;
-#endif
 
     return count;
 }
 
 
+//
+//  Recycle_Core: C
+//
+// Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
+// to be a series whose width is sizeof(REBSER*), and it will be filled with
+// the list of series that *would* be recycled.
+//
+REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
+{
+    return Recycle_Maybe_Lazy(shutdown, FALSE, sweeplist);
+}
+
+
+//
+//  Recycle_Auto: C
+//
+// The recycle run when the ballast is exhausted.  If lazy sweeping is
+// enabled, it leaves the sweeping to allocations.
+//
+REBCNT Recycle_Auto(void)
+{
+    if (GC_Lazy_Sweep)
+        return Recycle_Maybe_Lazy(FALSE, TRUE, NULL);
+
+    return Recycle();
+}
+
+
 //
 //  Recycle: C
 //
@@ -1742,6 +2525,8 @@ REBARR *Snapshot_All_Actions(void)
 {
     REBDSP dsp_orig = DSP;
 
+    Finish_Series_Sweep(); // unswept segments may have dead actions
+
     REBSEG *seg;
     for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
@@ -1785,11 +2570,23 @@ void Startup_GC(void)
     //
     GC_Guarded = Make_Series(15, sizeof(REBNOD*));
 
+    // Singular arrays of API handles, which are the roots of the GC.
+    //
+    GC_Roots = Make_Series(100, sizeof(REBARR*));
+
     // The marking queue used in lieu of recursion to ensure that deeply
     // nested structures don't cause the C stack to overflow.
     //
     GC_Mark_Stack = Make_Series(100, sizeof(REBARR*));
     TERM_SEQUENCE(GC_Mark_Stack);
+
+    // Series which became managed while a lazy sweep was pending.
+    //
+    GC_Sweep_Keeps = Make_Series(100, sizeof(REBSER*));
+
+    // Dead series whose freeing lazy sweeps left for a safe point.
+    //
+    GC_Sweep_Deferred = Make_Series(10, sizeof(REBSER*));
 }
 
 
@@ -1799,7 +2596,14 @@ void Startup_GC(void)
 void Shutdown_GC(void)
 {
     Free_Series(GC_Guarded);
+    Free_Series(GC_Roots);
     Free_Series(GC_Mark_Stack);
+    Free_Series(GC_Sweep_Keeps);
+    Free_Series(GC_Sweep_Deferred);
+
+  #ifdef PARALLEL_MARKING
+    Shutdown_Mark_Helpers();
+  #endif
 }
 
 
@@ -1890,6 +2694,8 @@ static REBCNT Sweep_Gobs(void)
                 UNMARK_GOB(gob);
             else {
                 Free_Node(GOB_POOL, gob);
+                ++GC_Nodes_Freed;
+                GC_Bytes_Freed += Mem_Pools[GOB_POOL].wide;
 
                 // GC_Ballast is of type REBINT, which might be long
                 // and REB_I32_ADD_OF takes (int*)
@@ -64,6 +64,16 @@
 // malloc and free.  You can enable this by setting the environment variable
 // R3_ALWAYS_MALLOC to 1.
 //
+// Very large series data (MEM_MAP_SIZE and up) is mapped into pages of its
+// own where mremap() is available.  Growing it is then done by remapping,
+// which the OS can do without copying, and freeing it gives the pages back
+// to the OS right away.  Setting R3_HUGE_PAGES to 1 will advise the OS to
+// use transparent huge pages for it.
+//
+
+#if defined(TO_LINUX) && !defined(__cplusplus)
+    #define _GNU_SOURCE // for mremap(), redundant under C++
+#endif
 
 #include "sys-core.h"
 
@@ -72,6 +82,10 @@
 
 #include "sys-int-funcs.h"
 
+#ifdef HAS_MREMAP
+    #include <sys/mman.h>
+#endif
+
 
 //
 //  Alloc_Mem: C
@@ -164,6 +178,51 @@ void Free_Mem(void *mem, size_t size)
 }
 
 
+#ifdef HAS_MREMAP
+
+//
+//  Map_Mem: C
+//
+// Counterpart to Alloc_Mem() for allocations big enough to be given pages
+// of their own.  The size must be a multiple of MEM_MAP_ALIGN.
+//
+static void *Map_Mem(size_t size)
+{
+    assert(size % MEM_MAP_ALIGN == 0);
+
+    PG_Mem_Usage += size;
+    if (PG_Mem_Limit != 0 and PG_Mem_Usage > PG_Mem_Limit)
+        Check_Security(Canon(SYM_MEMORY), POL_EXEC, 0);
+
+    void *p = mmap(
+        NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+    );
+    if (p == MAP_FAILED)
+        return NULL;
+
+  #ifdef MADV_HUGEPAGE
+    if (PG_Huge_Pages)
+        madvise(p, size, MADV_HUGEPAGE); // just advice, so failure is okay
+  #endif
+
+    return p;
+}
+
+
+//
+//  Unmap_Mem: C
+//
+static void Unmap_Mem(void *mem, size_t size)
+{
+    assert(size % MEM_MAP_ALIGN == 0);
+
+    munmap(mem, size);
+    PG_Mem_Usage -= size;
+}
+
+#endif
+
+
 inline static REBCNT FIND_POOL(size_t size) {
   #if !defined(NDEBUG)
     if (PG_Always_Malloc)
@@ -258,6 +317,13 @@ void Startup_Pools(REBINT scale)
     }
   #endif
 
+  #ifdef HAS_MREMAP
+    const char *env_huge_pages = getenv("R3_HUGE_PAGES");
+    PG_Huge_Pages = did (
+        env_huge_pages != NULL and atoi(env_huge_pages) != 0
+    );
+  #endif
+
     REBINT unscale = 1;
     if (scale == 0)
         scale = 1;
@@ -475,7 +541,8 @@ static void Fill_Pool(REBPOL *pool)
 //  Make_Node: C
 //
 // Allocate a node from a pool.  If the pool has run out of nodes, it will
-// be refilled.
+// be refilled--unless it is the SER_POOL and a lazy sweep of it is pending,
+// in which case sweeping segments is tried first.
 //
 // The node will not be zero-filled.  However its header bits will be
 // guaranteed to be zero--which is the same as the state of all freed nodes.
@@ -490,8 +557,13 @@ static void Fill_Pool(REBPOL *pool)
 void *Make_Node(REBCNT pool_id)
 {
     REBPOL *pool = &Mem_Pools[pool_id];
-    if (pool->first == NULL)
-        Fill_Pool(pool);
+    if (pool->first == NULL) {
+        if (pool_id == SER_POOL and GC_Sweep_Seg != NULL and not GC_Sweeping)
+            Sweep_Series_Lazily();
+
+        if (pool->first == NULL)
+            Fill_Pool(pool);
+    }
 
     assert(pool->first != NULL);
 
@@ -541,6 +613,14 @@ void Free_Node(REBCNT pool_id, void *p)
 
     REBPOL *pool = &Mem_Pools[pool_id];
 
+    // While a sweep of the SER_POOL is pending, only the sweep links nodes
+    // into its free list.  If this node's segment hasn't been swept, then
+    // that will happen when it is.  Otherwise the node has to wait for the
+    // next recycle's sweep.  (See notes on lazy sweeping in %m-gc.c)
+    //
+    if (pool_id == SER_POOL and GC_Sweep_Seg != NULL)
+        return;
+
   #ifdef NDEBUG
     node->next_if_free = pool->first;
     pool->first = node;
@@ -568,6 +648,156 @@ void Free_Node(REBCNT pool_id, void *p)
 }
 
 
+// qsort() callback for putting segments in order of their addresses.
+//
+static int Compare_Segments(const void *a, const void *b)
+{
+    uintptr_t x = cast(uintptr_t, *cast(REBSEG* const*, a));
+    uintptr_t y = cast(uintptr_t, *cast(REBSEG* const*, b));
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+
+// Segments are sorted by address, so the last one starting at or before the
+// node is the one containing it.
+//
+static REBCNT Find_Segment(REBSEG **segs, REBCNT num_segs, REBNOD *node)
+{
+    REBCNT lo = 0;
+    REBCNT hi = num_segs;
+    while (hi - lo > 1) {
+        REBCNT mid = lo + (hi - lo) / 2;
+        if (cast(uintptr_t, segs[mid]) <= cast(uintptr_t, node))
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
+//
+//  Release_Empty_Segments: C
+//
+// Give the segments of a pool that have no nodes in use back to the OS.  The
+// free list is the only record of which nodes are free, so it is walked to
+// count the free nodes in each segment--and rebuilt without the nodes of the
+// segments that are released.  Returns the number of bytes released.
+//
+// Unless `force` is set, this only happens once more than half of the pool
+// is free, and enough empty segments are kept to allocate a quarter again as
+// many nodes as are in use (never less than one segment).  That gap keeps a
+// pool whose usage hovers near a segment boundary from thrashing.
+//
+static REBCNT Release_Empty_Segments(REBPOL *pool, REBOOL force)
+{
+    REBCNT units = pool->units;
+    if (pool->free < units)
+        return 0; // can't have a segment without nodes in use
+
+    if (not force and pool->free <= pool->has / 2)
+        return 0;
+
+    REBCNT reserve = force ? 0 : MAX(units, (pool->has - pool->free) / 4);
+    if (pool->free < reserve + units)
+        return 0;
+
+    REBCNT num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != NULL; seg = seg->next)
+        ++num_segs;
+
+    REBSEG **segs = ALLOC_N(REBSEG*, num_segs);
+    REBCNT *frees = ALLOC_N(REBCNT, num_segs);
+    CLEAR(frees, sizeof(REBCNT) * num_segs);
+
+    REBCNT n = 0;
+    for (seg = pool->segs; seg != NULL; seg = seg->next)
+        segs[n++] = seg;
+    qsort(segs, num_segs, sizeof(REBSEG*), &Compare_Segments);
+
+    REBNOD *node;
+    for (node = pool->first; node != NULL; node = node->next_if_free)
+        ++frees[Find_Segment(segs, num_segs, node)];
+
+    REBCNT released = 0;
+    for (n = 0; n < num_segs; ++n) {
+        if (pool->free - released < reserve + units)
+            break;
+        if (frees[n] == units) {
+            frees[n] = NOT_FOUND; // signals the segment is being released
+            released += units;
+        }
+    }
+
+    if (released != 0) {
+        REBNOD *first = NULL;
+        REBNOD *last = NULL;
+        node = pool->first;
+        while (node != NULL) {
+            REBNOD *next = node->next_if_free;
+            if (frees[Find_Segment(segs, num_segs, node)] != NOT_FOUND) {
+                if (last == NULL)
+                    first = node;
+                else
+                    last->next_if_free = node;
+                last = node;
+            }
+            node = next;
+        }
+        if (last != NULL)
+            last->next_if_free = NULL;
+        pool->first = first;
+        pool->last = last;
+
+        REBSEG **link = &pool->segs;
+        while ((seg = *link) != NULL) {
+            n = Find_Segment(segs, num_segs, cast(REBNOD*, seg));
+            if (frees[n] != NOT_FOUND)
+                link = &seg->next;
+            else {
+                *link = seg->next;
+                FREE_N(char, seg->size, cast(char*, seg));
+            }
+        }
+
+        pool->has -= released;
+        pool->free -= released;
+    }
+
+    FREE_N(REBCNT, num_segs, frees);
+    FREE_N(REBSEG*, num_segs, segs);
+
+    return released * pool->wide + (released / units) * sizeof(REBSEG);
+}
+
+
+//
+//  Compact_Pools: C
+//
+// Release empty segments from all of the pools (see Release_Empty_Segments)
+// and return how many bytes that gave back.  The garbage collector does this
+// after full recycles, and RECYCLE/COMPACT forces it.
+//
+// The SER_POOL's free list is incomplete while a lazy sweep is pending, so
+// it is left alone until that sweep finishes.
+//
+REBU64 Compact_Pools(REBOOL force)
+{
+    REBU64 bytes = 0;
+
+    REBCNT pool_num;
+    for (pool_num = 0; pool_num < SYSTEM_POOL; ++pool_num) {
+        if (pool_num == SER_POOL and GC_Sweep_Seg != NULL)
+            continue;
+        bytes += Release_Empty_Segments(&Mem_Pools[pool_num], force);
+    }
+
+    PG_Mem_Released += bytes;
+    return bytes;
+}
+
+
 //
 //  Series_Data_Alloc: C
 //
@@ -626,7 +856,15 @@ static REBOOL Series_Data_Alloc(REBSER *s, REBCNT length) {
                 CLEAR_SER_FLAG(s, SERIES_FLAG_POWER_OF_2);
         }
 
-        s->content.dynamic.data = ALLOC_N(char, size);
+      #ifdef HAS_MREMAP
+        if (ROUND_TO_MAP_ALIGN(size) >= MEM_MAP_SIZE) {
+            size = ROUND_TO_MAP_ALIGN(size); // (rest will waste size % wide)
+            s->content.dynamic.data = cast(char*, Map_Mem(size));
+        }
+        else
+      #endif
+            s->content.dynamic.data = ALLOC_N(char, size);
+
         if (s->content.dynamic.data == NULL)
             return FALSE;
 
@@ -841,6 +1079,11 @@ REBCNT Series_Allocation_Unpooled(REBSER *series)
         return len;
     }
 
+  #ifdef HAS_MREMAP
+    if (ROUND_TO_MAP_ALIGN(total) >= MEM_MAP_SIZE)
+        return ROUND_TO_MAP_ALIGN(total); // mapped, see Series_Data_Alloc()
+  #endif
+
     return total;
 }
 
@@ -960,6 +1203,11 @@ REBSER *Make_Series_Core(REBCNT capacity, REBYTE wide, REBFLGS flags)
             CLEAR_SER_FLAG(s, ARRAY_FLAG_FILE_LINE);
     }
 
+    if (TG_Sample_Every != 0) // allocation profiler is on
+        Sample_Allocation(s, sizeof(REBSER) + (
+            GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC) ? SER_TOTAL(s) : 0
+        ));
+
     assert(s->info.bits & NODE_FLAG_END);
     assert(not (s->info.bits & NODE_FLAG_CELL));
     assert(SER_LEN(s) == 0);
@@ -1013,6 +1261,9 @@ REBVAL *Alloc_Pairing(void) {
 //
 void Manage_Pairing(REBVAL *paired) {
     SET_VAL_FLAG(paired, NODE_FLAG_MANAGED);
+
+    if (GC_Sweep_Seg != NULL)
+        Keep_Series_From_Sweep(cast(REBSER*, paired));
 }
 
 
@@ -1027,7 +1278,10 @@ void Manage_Pairing(REBVAL *paired) {
 //
 void Unmanage_Pairing(REBVAL *paired) {
     assert(GET_VAL_FLAG(paired, NODE_FLAG_MANAGED));
-    CLEAR_VAL_FLAG(paired, NODE_FLAG_MANAGED);
+
+    // (It may be marked if a lazy sweep is pending, see %m-gc.c)
+    //
+    CLEAR_VAL_FLAGS(paired, NODE_FLAG_MANAGED | NODE_FLAG_MARKED);
 }
 
 
@@ -1084,13 +1338,220 @@ static void Free_Unbiased_Series_Data(char *unbiased, REBCNT size_unpooled)
         alias->bits = FLAGBYTE_FIRST(FREED_SERIES_BYTE);
     }
     else {
-        FREE_N(char, size_unpooled, unbiased);
+      #ifdef HAS_MREMAP
+        if (size_unpooled >= MEM_MAP_SIZE)
+            Unmap_Mem(unbiased, size_unpooled);
+        else
+      #endif
+            FREE_N(char, size_unpooled, unbiased);
+
         Mem_Pools[SYSTEM_POOL].has -= size_unpooled;
         Mem_Pools[SYSTEM_POOL].free++;
     }
 }
 
 
+//
+//  Close_Series_Gap: C
+//
+// Slide the data after a series's gap (see SERIES_FLAG_HAS_GAP) back down
+// to meet the data before it, so the unused capacity is after the tail.
+//
+void Close_Series_Gap(REBSER *s)
+{
+    assert(s == TG_Gap_Series);
+
+    REBYTE wide = SER_WIDE(s);
+    REBYTE *data = cast(REBYTE*, s->content.dynamic.data);
+    memmove(
+        data + (wide * TG_Gap_At),
+        data + (wide * (TG_Gap_At + TG_Gap_Size)),
+        wide * (s->content.dynamic.len - TG_Gap_At)
+    );
+
+    CLEAR_SER_FLAG(s, SERIES_FLAG_HAS_GAP);
+    TG_Gap_Series = NULL;
+
+    // A gap that didn't save any moves cost one; don't open another for the
+    // series until it is edited in the middle twice in a row again.
+    //
+    TG_Gap_Candidate = (TG_Gap_Hits == 0) ? NULL : s;
+
+    TERM_SEQUENCE(s);
+}
+
+
+//
+//  Forget_Series_Gap: C
+//
+// When a series is freed, its gap has no data to be moved, but the series
+// should not be left as TG_Gap_Series.
+//
+static void Forget_Series_Gap(REBSER *s)
+{
+    if (GET_SER_FLAG(s, SERIES_FLAG_HAS_GAP)) {
+        CLEAR_SER_FLAG(s, SERIES_FLAG_HAS_GAP);
+        TG_Gap_Series = NULL;
+    }
+    if (TG_Gap_Candidate == s)
+        TG_Gap_Candidate = NULL;
+}
+
+
+//
+//  Fill_Series_Gap: C
+//
+// Insert `delta` units at `index` by moving the gap there and taking them
+// out of it.  This only moves the data between the last edit and this one.
+//
+static void Fill_Series_Gap(REBSER *s, REBCNT index, REBCNT delta)
+{
+    assert(s == TG_Gap_Series and delta <= TG_Gap_Size);
+
+    REBYTE wide = SER_WIDE(s);
+    REBYTE *data = cast(REBYTE*, s->content.dynamic.data);
+    if (index < TG_Gap_At)
+        memmove(
+            data + (wide * (index + TG_Gap_Size)),
+            data + (wide * index),
+            wide * (TG_Gap_At - index)
+        );
+    else if (index > TG_Gap_At)
+        memmove(
+            data + (wide * TG_Gap_At),
+            data + (wide * (TG_Gap_At + TG_Gap_Size)),
+            wide * (index - TG_Gap_At)
+        );
+
+    TG_Gap_At = index + delta;
+    TG_Gap_Size -= delta;
+    s->content.dynamic.len += delta;
+    ++TG_Gap_Hits;
+
+    if (TG_Gap_Size == 0) { // used up, so the series is contiguous again
+        CLEAR_SER_FLAG(s, SERIES_FLAG_HAS_GAP);
+        TG_Gap_Series = NULL;
+        TG_Gap_Candidate = s;
+        TERM_SEQUENCE(s);
+    }
+}
+
+
+//
+//  Open_Series_Gap: C
+//
+// Insert `delta` units at `index` by moving the data after it all the way
+// to the end of the capacity, leaving what isn't used as a gap for edits
+// that come next.  Caller checks there is room for it.
+//
+static void Open_Series_Gap(REBSER *s, REBCNT index, REBCNT delta)
+{
+    if (TG_Gap_Series != NULL)
+        Close_Series_Gap(TG_Gap_Series);
+
+    REBCNT len = s->content.dynamic.len;
+    REBCNT gap = s->content.dynamic.rest - 1 - len; // keep terminator's unit
+    assert(delta < gap);
+
+    REBYTE wide = SER_WIDE(s);
+    REBYTE *data = cast(REBYTE*, s->content.dynamic.data);
+    memmove(
+        data + (wide * (index + gap)),
+        data + (wide * index),
+        wide * (len - index)
+    );
+
+    SET_SER_FLAG(s, SERIES_FLAG_HAS_GAP);
+    TG_Gap_Series = s;
+    TG_Gap_At = index + delta;
+    TG_Gap_Size = gap - delta;
+    TG_Gap_Hits = 0;
+    s->content.dynamic.len += delta;
+}
+
+
+#ifdef HAS_MREMAP
+
+//
+//  Remap_Series_Data: C
+//
+// If a series's data was mapped on its own (see Series_Data_Alloc()), then
+// growing it can be done with mremap().  The kernel can move the pages to a
+// new address without copying them, and often extends them in place.  Any
+// bias is given up, because the new capacity makes it moot.
+//
+// Returns FALSE if the data was not mapped, so an ordinary reallocation is
+// needed.  Otherwise the series has at least `units` capacity on return.
+//
+static REBOOL Remap_Series_Data(REBSER *s, REBCNT units)
+{
+    assert(GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC));
+
+    REBCNT size_old = Series_Allocation_Unpooled(s);
+    if (size_old < MEM_MAP_SIZE)
+        return FALSE;
+
+    REBYTE wide = SER_WIDE(s);
+    REBCNT bias = SER_BIAS(s);
+
+    REBU64 size = size_old; // double it, as Expand_Series() would
+    while (size < cast(REBU64, units) * wide)
+        size *= 2;
+    if (size > INT32_MAX)
+        fail (Error_No_Memory(cast(REBCNT, size)));
+
+    PG_Mem_Usage += size - size_old;
+    if (PG_Mem_Limit != 0 and PG_Mem_Usage > PG_Mem_Limit)
+        Check_Security(Canon(SYM_MEMORY), POL_EXEC, 0);
+
+    char *base = s->content.dynamic.data - (wide * bias);
+    void *p = mremap(base, size_old, cast(size_t, size), MREMAP_MAYMOVE);
+    if (p == MAP_FAILED) {
+        PG_Mem_Usage -= size - size_old;
+        fail (Error_No_Memory(cast(REBCNT, size)));
+    }
+
+    base = cast(char*, p);
+    if (bias != 0)
+        memmove(base, base + (wide * bias), SER_LEN(s) * wide);
+
+    s->content.dynamic.data = base;
+    SER_SET_BIAS(s, 0);
+    s->content.dynamic.rest = cast(REBCNT, size) / wide;
+
+    Mem_Pools[SYSTEM_POOL].has += size - size_old;
+
+    if ((GC_Ballast -= cast(REBINT, size - size_old)) <= 0)
+        SET_SIGNAL(SIG_RECYCLE);
+
+    if (TG_Sample_Every != 0) // allocation profiler is on
+        Sample_Allocation(s, cast(REBCNT, size - size_old));
+
+    if (GET_SER_FLAG(s, SERIES_FLAG_ARRAY)) {
+        //
+        // Same convention as Series_Data_Alloc(): settable trash up to the
+        // last cell of the capacity, which is an unwritable END.
+        //
+        REBCNT n;
+        for (n = SER_LEN(s); n < s->content.dynamic.rest - 1; n++)
+            Prep_Non_Stack_Cell(ARR_AT(ARR(s), n));
+
+        RELVAL *ultimate = ARR_AT(ARR(s), s->content.dynamic.rest - 1);
+        Init_Endlike_Header(&ultimate->header, 0);
+        TRACK_CELL_IF_DEBUG(ultimate, __FILE__, __LINE__);
+    }
+
+  #if !defined(NDEBUG)
+    assert(Series_Allocation_Unpooled(s) == size);
+    PG_Reb_Stats->Series_Expanded++;
+  #endif
+
+    return TRUE;
+}
+
+#endif
+
+
 //
 //  Expand_Series: C
 //
@@ -1140,6 +1601,14 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
 
     if (delta == 0) return;
 
+    if (GET_SER_FLAG(s, SERIES_FLAG_HAS_GAP)) {
+        if (delta <= TG_Gap_Size) {
+            Fill_Series_Gap(s, index, delta);
+            return;
+        }
+        Close_Series_Gap(s);
+    }
+
     REBCNT len_old = SER_LEN(s);
 
     REBYTE wide = SER_WIDE(s);
@@ -1179,6 +1648,37 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     REBCNT extra = delta * wide;
     REBCNT size = SER_LEN(s) * wide;
 
+  #ifdef HAS_MREMAP
+    //
+    // Mapped data can grow without a copy, after which it can just slide.
+    //
+    if (
+        was_dynamic
+        and (size + extra + wide) > SER_REST(s) * SER_WIDE(s)
+        and NOT_SER_FLAG(s, SERIES_FLAG_FIXED_SIZE)
+    ){
+        Remap_Series_Data(s, len_old + delta + 1);
+    }
+  #endif
+
+    // A string or binary edited in the middle twice in a row gets a gap, if
+    // there will be some capacity left over for one.  See Close_Series_Gap()
+    // for when that resets.
+    //
+    if (
+        was_dynamic
+        and index != 0
+        and index < len_old
+        and NOT_SER_FLAG(s, SERIES_FLAG_ARRAY)
+        and (size + extra + wide) < SER_REST(s) * SER_WIDE(s)
+    ){
+        if (TG_Gap_Candidate == s) {
+            Open_Series_Gap(s, index, delta);
+            return;
+        }
+        TG_Gap_Candidate = s;
+    }
+
     // + wide for terminator
     if ((size + extra + wide) <= SER_REST(s) * SER_WIDE(s)) {
         //
@@ -1298,6 +1798,9 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     if (n_found >= MAX_EXPAND_LIST)
         Prior_Expand[n_available] = s;
 
+    if (TG_Sample_Every != 0) // allocation profiler is on
+        Sample_Allocation(s, SER_TOTAL(s));
+
     // Copy the series up to the expansion point
     //
     memcpy(s->content.dynamic.data, data_old, start);
@@ -1325,7 +1828,7 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     PG_Reb_Stats->Series_Expanded++;
   #endif
 
-    assert(NOT_SER_FLAG(s, NODE_FLAG_MARKED));
+    assert(GC_Sweep_Seg != NULL or NOT_SER_FLAG(s, NODE_FLAG_MARKED));
 }
 
 
@@ -1337,6 +1840,11 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
 //
 void Swap_Series_Content(REBSER* a, REBSER* b)
 {
+    if (GET_SER_FLAG(a, SERIES_FLAG_HAS_GAP))
+        Close_Series_Gap(a);
+    if (GET_SER_FLAG(b, SERIES_FLAG_HAS_GAP))
+        Close_Series_Gap(b);
+
     // While the data series underlying a string may change widths over the
     // lifetime of that string node, there's not really any reasonable case
     // for mutating an array node into a non-array or vice versa.
@@ -1402,6 +1910,9 @@ void Remake_Series(REBSER *s, REBCNT units, REBYTE wide, REBFLGS flags)
 
     assert(NOT_SER_FLAG(s, SERIES_FLAG_FIXED_SIZE));
 
+    if (GET_SER_FLAG(s, SERIES_FLAG_HAS_GAP))
+        Close_Series_Gap(s);
+
     REBOOL was_dynamic = GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC);
 
     REBINT bias_old;
@@ -1486,6 +1997,18 @@ void GC_Kill_Series(REBSER *s)
 
     assert(not (s->header.bits & NODE_FLAG_CELL)); // use Free_Paired
 
+    if (GET_SER_INFO(s, SERIES_INFO_SAMPLED))
+        Unsample_Series(s); // allocation profiler picked it
+
+    // Free_Series() also comes here, but only with unmanaged series.
+    //
+    if (IS_SERIES_MANAGED(s)) {
+        ++GC_Nodes_Freed;
+        GC_Bytes_Freed += sizeof(REBSER);
+        if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC))
+            GC_Bytes_Freed += SER_TOTAL(s);
+    }
+
     if (GET_SER_FLAG(s, SERIES_FLAG_UTF8_STRING))
         GC_Kill_Interning(s); // needs special handling to adjust canons
 
@@ -1495,6 +2018,8 @@ void GC_Kill_Series(REBSER *s)
         if (Prior_Expand[n] == s) Prior_Expand[n] = 0;
     }
 
+    Forget_Series_Gap(s);
+
     if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)) {
         REBCNT size = SER_TOTAL(s);
 
@@ -1668,6 +2193,9 @@ void Manage_Series(REBSER *s)
     s->header.bits |= NODE_FLAG_MANAGED;
 
     Drop_Manual_Series(s);
+
+    if (GC_Sweep_Seg != NULL)
+        Keep_Series_From_Sweep(s);
 }
 
 
@@ -1827,7 +2355,10 @@ REBCNT Check_Memory_Debug(void)
             if (pool_num >= SER_POOL)
                 continue; // size doesn't match a known pool
 
-            if (Mem_Pools[pool_num].wide != SER_TOTAL(s))
+            // The capacity is what fits in the pooled allocation, which may
+            // leave a remainder if the width doesn't divide it evenly.
+            //
+            if (Mem_Pools[pool_num].wide - SER_TOTAL(s) >= SER_WIDE(s))
                 panic (s);
         }
     }
@@ -66,7 +66,7 @@ REBCNT Insert_Series(
     Expand_Series(s, index, len); // tail += len
 
     memcpy(
-        SER_DATA_RAW(s) + (SER_WIDE(s) * index),
+        SER_SPAN_RAW(SER_WIDE(s), s, index, len), // can leave gap open
         data,
         SER_WIDE(s) * len
     );
@@ -191,6 +191,27 @@ void Remove_Series(REBSER *s, REBCNT index, REBINT len)
 {
     if (len <= 0) return;
 
+    Note_Array_Modified(s);
+
+    if (GET_SER_FLAG(s, SERIES_FLAG_HAS_GAP)) {
+        //
+        // Removals that end where the gap starts (like a backspace) or that
+        // start where it ends (like a delete) just make the gap bigger.
+        //
+        REBCNT end = index + cast(REBCNT, len);
+        if (
+            end == TG_Gap_At
+            or (index == TG_Gap_At and end <= s->content.dynamic.len)
+        ){
+            TG_Gap_At = index;
+            TG_Gap_Size += len;
+            s->content.dynamic.len -= len;
+            ++TG_Gap_Hits;
+            return;
+        }
+        Close_Series_Gap(s);
+    }
+
     REBOOL is_dynamic = GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC);
     REBCNT len_old = SER_LEN(s);
 
@@ -279,6 +300,9 @@ void Remove_Series(REBSER *s, REBCNT index, REBINT len)
 //
 void Unbias_Series(REBSER *s, REBOOL keep)
 {
+    if (GET_SER_FLAG(s, SERIES_FLAG_HAS_GAP))
+        Close_Series_Gap(s);
+
     REBCNT len = SER_BIAS(s);
     if (len == 0)
         return;
@@ -359,6 +383,8 @@ void Clear_Series(REBSER *s)
 void Resize_Series(REBSER *s, REBCNT size)
 {
     if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)) {
+        if (GET_SER_FLAG(s, SERIES_FLAG_HAS_GAP))
+            Close_Series_Gap(s);
         s->content.dynamic.len = 0;
         Unbias_Series(s, TRUE);
     }
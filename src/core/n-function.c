@@ -660,6 +660,569 @@ REBNATIVE(enclose)
 }
 
 
+//
+// MEMOIZE keeps the results of an action's past calls in a table, keyed by
+// the values of the arguments those calls were made with.  Arguments are
+// hashed in place in the frame with Hash_Value(), so nothing is allocated
+// to look a call up--only a miss copies its arguments into the table.
+//
+// The table is open addressed (with linear probing, and backward shifting
+// on removal) over entry numbers.  The entries themselves are rows in a
+// managed array, so the GC sees the keys and results.  Room for entries is
+// doubled as they are added, and once the table holds its capacity the
+// least recently used entry is evicted for a new one.
+//
+// Only arguments that can't change after the call are used as keys, else a
+// change could make a stored key match when it shouldn't.  So a call with
+// an ANY-CONTEXT!, MAP!, or series that isn't frozen (deeply, for arrays)
+// bypasses the table and just runs the inner action, as do calls with
+// unhashable arguments (e.g. BITSET! or VARARGS!).  The results are kept
+// as-is...so memoize actions that don't modify them.
+//
+#define MIN_MEMO_ENTRIES 8 // entries made room for at first
+
+struct Reb_Memo {
+    REBCNT capacity; // entries held before least recently used is evicted
+    REBCNT allocated; // entries there is room for, grows up to capacity
+    REBCNT width; // cells per entry: keyed args, then result
+    REBCNT count; // entries in use
+    REBCNT mask; // number of slots minus one (slots are a power of 2)
+    REBCNT *slots; // entry number + 1, or 0 if the slot is empty
+    uint32_t *hashes; // hash of each entry's arguments
+    REBCNT *newer; // LRU links per entry, `capacity` if none
+    REBCNT *older;
+    REBCNT newest;
+    REBCNT oldest;
+    REBI64 hits;
+    REBI64 misses;
+};
+
+
+static void Cleanup_Memo(const REBVAL *v)
+{
+    struct Reb_Memo *memo = VAL_HANDLE_POINTER(struct Reb_Memo, v);
+    FREE_N(REBCNT, memo->mask + 1, memo->slots);
+    FREE_N(uint32_t, memo->allocated, memo->hashes);
+    FREE_N(REBCNT, memo->allocated, memo->newer);
+    FREE_N(REBCNT, memo->allocated, memo->older);
+    FREE(struct Reb_Memo, memo);
+}
+
+
+// Only arguments the caller supplies are part of the key.
+//
+inline static REBOOL Is_Memo_Key_Param(const REBVAL *param) {
+    switch (VAL_PARAM_CLASS(param)) {
+    case PARAM_CLASS_LOCAL:
+    case PARAM_CLASS_RETURN:
+    case PARAM_CLASS_LEAVE:
+        return FALSE;
+
+    default:
+        return TRUE;
+    }
+}
+
+
+// Can the value be part of a key?  It must be of a type Hash_Value() can be
+// used on, and it must not be able to change.  (Arrays are checked all the
+// way down, as their items are compared when looking up a key.)
+//
+static REBOOL Is_Memo_Key_Value(const RELVAL *v)
+{
+    if (C_STACK_OVERFLOWING(&v))
+        Fail_Stack_Overflow();
+
+    switch (VAL_TYPE(v)) {
+    case REB_BITSET:
+    case REB_IMAGE:
+    case REB_VECTOR:
+    case REB_TYPESET:
+    case REB_VARARGS:
+    case REB_GOB:
+    case REB_EVENT:
+    case REB_HANDLE:
+    case REB_STRUCT:
+    case REB_LIBRARY:
+        return FALSE; // not hashable
+
+    case REB_MAP:
+        return FALSE; // mutable
+
+    default:
+        break;
+    }
+
+    if (ANY_CONTEXT(v))
+        return FALSE; // mutable
+
+    if (ANY_ARRAY(v)) {
+        if (not Is_Array_Deeply_Frozen(VAL_ARRAY(v)))
+            return FALSE;
+
+        const RELVAL *item = VAL_ARRAY_AT(v);
+        for (; NOT_END(item); ++item) {
+            if (not Is_Memo_Key_Value(item))
+                return FALSE;
+        }
+        return TRUE;
+    }
+
+    if (ANY_SERIES(v))
+        return Is_Series_Frozen(VAL_SERIES(v));
+
+    return TRUE;
+}
+
+
+// Hash the keyed arguments of a frame for its memo table.  Returns FALSE
+// if any of them can't be part of a key (see Is_Memo_Key_Value()).
+//
+static REBOOL Hash_Memo_Args(uint32_t *hash_out, REBFRM *f)
+{
+    uint32_t hash = 0;
+
+    REBVAL *param = ACT_FACADE_HEAD(f->phase);
+    REBVAL *arg = f->args_head;
+    for (; NOT_END(param); ++param, ++arg) {
+        if (not Is_Memo_Key_Param(param))
+            continue;
+
+        if (IS_VOID(arg)) {
+            hash = (hash * 31) + 0x9E3779B9; // void isn't hashable, but keys
+            continue;
+        }
+
+        if (not Is_Memo_Key_Value(arg))
+            return FALSE;
+
+        hash = (hash * 31) + Hash_Value(arg);
+    }
+
+    *hash_out = hash;
+    return TRUE;
+}
+
+
+// Does the entry's row of stored arguments match the frame's arguments?
+//
+static REBOOL Memo_Args_Match(RELVAL *row, REBFRM *f)
+{
+    REBVAL *param = ACT_FACADE_HEAD(f->phase);
+    REBVAL *arg = f->args_head;
+    for (; NOT_END(param); ++param, ++arg) {
+        if (not Is_Memo_Key_Param(param))
+            continue;
+
+        if (VAL_TYPE(row) != VAL_TYPE(arg))
+            return FALSE;
+        if (not IS_VOID(arg) and Cmp_Value(row, arg, TRUE) != 0)
+            return FALSE;
+        ++row;
+    }
+    return TRUE;
+}
+
+
+// Probe for the frame's arguments.  The returned slot holds the matching
+// entry, or is the empty slot where an entry for them would go.
+//
+static REBCNT Find_Memo_Slot(
+    struct Reb_Memo *memo,
+    REBARR *entries,
+    uint32_t hash,
+    REBFRM *f
+){
+    REBCNT slot = hash & memo->mask;
+    while (memo->slots[slot] != 0) {
+        REBCNT e = memo->slots[slot] - 1;
+        if (
+            memo->hashes[e] == hash
+            and Memo_Args_Match(ARR_AT(entries, e * memo->width), f)
+        ){
+            return slot;
+        }
+        slot = (slot + 1) & memo->mask;
+    }
+    return slot;
+}
+
+
+static void Unlink_Memo_Entry(struct Reb_Memo *memo, REBCNT e)
+{
+    if (memo->newer[e] == memo->capacity)
+        memo->newest = memo->older[e];
+    else
+        memo->older[memo->newer[e]] = memo->older[e];
+
+    if (memo->older[e] == memo->capacity)
+        memo->oldest = memo->newer[e];
+    else
+        memo->newer[memo->older[e]] = memo->newer[e];
+}
+
+
+static void Link_Memo_Entry_Newest(struct Reb_Memo *memo, REBCNT e)
+{
+    memo->newer[e] = memo->capacity;
+    memo->older[e] = memo->newest;
+    if (memo->newest == memo->capacity)
+        memo->oldest = e;
+    else
+        memo->newer[memo->newest] = e;
+    memo->newest = e;
+}
+
+
+// Take an entry out of the slots.  Entries probed in after it are shifted
+// back, so no probe sequence has a hole in it.
+//
+static void Remove_Memo_Entry_Slot(struct Reb_Memo *memo, REBCNT e)
+{
+    REBCNT hole = memo->hashes[e] & memo->mask;
+    while (memo->slots[hole] != e + 1)
+        hole = (hole + 1) & memo->mask;
+
+    REBCNT slot = hole;
+    while (TRUE) {
+        slot = (slot + 1) & memo->mask;
+        if (memo->slots[slot] == 0)
+            break;
+
+        REBCNT home = memo->hashes[memo->slots[slot] - 1] & memo->mask;
+        REBOOL reachable = (hole <= slot)
+            ? (hole < home and home <= slot)
+            : (hole < home or home <= slot);
+        if (reachable)
+            continue; // its probe doesn't pass through the hole
+
+        memo->slots[hole] = memo->slots[slot];
+        hole = slot;
+    }
+    memo->slots[hole] = 0;
+}
+
+
+// Make room for twice as many entries (up to the capacity).  There are
+// twice as many slots as entries, so the slots are made again too.
+//
+static void Grow_Memo(struct Reb_Memo *memo, REBARR *entries)
+{
+    REBCNT old = memo->allocated;
+    REBCNT allocated = (old * 2 < memo->capacity) ? old * 2 : memo->capacity;
+
+    uint32_t *hashes = ALLOC_N(uint32_t, allocated);
+    REBCNT *newer = ALLOC_N(REBCNT, allocated);
+    REBCNT *older = ALLOC_N(REBCNT, allocated);
+    memcpy(hashes, memo->hashes, old * sizeof(uint32_t));
+    memcpy(newer, memo->newer, old * sizeof(REBCNT));
+    memcpy(older, memo->older, old * sizeof(REBCNT));
+    FREE_N(uint32_t, old, memo->hashes);
+    FREE_N(REBCNT, old, memo->newer);
+    FREE_N(REBCNT, old, memo->older);
+    memo->hashes = hashes;
+    memo->newer = newer;
+    memo->older = older;
+    memo->allocated = allocated;
+
+    REBCNT num_slots = memo->mask + 1;
+    if (num_slots < allocated * 2) {
+        FREE_N(REBCNT, num_slots, memo->slots);
+        while (num_slots < allocated * 2)
+            num_slots <<= 1;
+        memo->slots = ALLOC_N_ZEROFILL(REBCNT, num_slots);
+        memo->mask = num_slots - 1;
+
+        REBCNT e;
+        for (e = 0; e < memo->count; ++e) {
+            REBCNT slot = memo->hashes[e] & memo->mask;
+            while (memo->slots[slot] != 0)
+                slot = (slot + 1) & memo->mask;
+            memo->slots[slot] = e + 1;
+        }
+    }
+
+    // The entries are filled in as results come in, so start out with voids
+    // (which the array says are expected).
+    //
+    REBCNT cells = allocated * memo->width;
+    REBCNT n = ARR_LEN(entries);
+    EXPAND_SERIES_TAIL(SER(entries), cells - n);
+    for (; n < cells; ++n)
+        Init_Void(ARR_AT(entries, n));
+    TERM_ARRAY_LEN(entries, cells);
+}
+
+
+//
+//  Memoizer_Dispatcher: C
+//
+// Dispatcher used by MEMOIZE.
+//
+REB_R Memoizer_Dispatcher(REBFRM *f)
+{
+    RELVAL *memoization = ACT_BODY(f->phase);
+    assert(ARR_LEN(VAL_ARRAY(memoization)) == 3);
+
+    REBVAL *inner = KNOWN(VAL_ARRAY_AT_HEAD(memoization, 0));
+    REBARR *entries = VAL_ARRAY(VAL_ARRAY_AT_HEAD(memoization, 1));
+    struct Reb_Memo *memo = VAL_HANDLE_POINTER(
+        struct Reb_Memo, VAL_ARRAY_AT_HEAD(memoization, 2)
+    );
+
+    uint32_t hash;
+    if (not Hash_Memo_Args(&hash, f)) {
+        f->phase = VAL_ACTION(inner);
+        f->binding = VAL_BINDING(inner);
+        return R_REDO_UNCHECKED; // signatures match, as with CHAIN
+    }
+
+    REBCNT slot = Find_Memo_Slot(memo, entries, hash, f);
+    if (memo->slots[slot] != 0) {
+        REBCNT e = memo->slots[slot] - 1;
+        ++memo->hits;
+        Unlink_Memo_Entry(memo, e);
+        Link_Memo_Entry_Newest(memo, e);
+        Move_Value(
+            f->out,
+            KNOWN(ARR_AT(entries, (e * memo->width) + memo->width - 1))
+        );
+        return R_OUT;
+    }
+
+    ++memo->misses;
+
+    // Run the inner action on a copy of this frame's arguments, as DO of a
+    // FRAME! would.  (They stay as they are here, to be stored as the key.)
+    //
+    DECLARE_FRAME (sub);
+    sub->out = f->out;
+
+    Push_Frame_For_Apply(sub);
+    Push_Action(sub, f->opt_label, VAL_ACTION(inner), VAL_BINDING(inner));
+    sub->refine = ORDINARY_ARG;
+    sub->special = f->args_head;
+
+    (*PG_Do)(sub);
+
+    Drop_Frame_Core(sub);
+
+    if (THROWN(f->out))
+        return R_OUT_IS_THROWN; // nothing is remembered for throws
+
+    // The inner action may have run this memoized action recursively, which
+    // can move entries around (or even add this one), so probe again.
+    //
+    slot = Find_Memo_Slot(memo, entries, hash, f);
+    if (memo->slots[slot] != 0) {
+        REBCNT e = memo->slots[slot] - 1;
+        Move_Value(
+            ARR_AT(entries, (e * memo->width) + memo->width - 1),
+            f->out
+        );
+        return R_OUT;
+    }
+
+    REBCNT e;
+    if (memo->count < memo->capacity) {
+        if (memo->count == memo->allocated) {
+            Grow_Memo(memo, entries);
+            slot = Find_Memo_Slot(memo, entries, hash, f);
+        }
+        e = memo->count++;
+    }
+    else {
+        e = memo->oldest;
+        Unlink_Memo_Entry(memo, e);
+        Remove_Memo_Entry_Slot(memo, e);
+        slot = Find_Memo_Slot(memo, entries, hash, f);
+    }
+
+    RELVAL *row = ARR_AT(entries, e * memo->width);
+
+    REBVAL *param = ACT_FACADE_HEAD(f->phase);
+    REBVAL *arg = f->args_head;
+    for (; NOT_END(param); ++param, ++arg) {
+        if (not Is_Memo_Key_Param(param))
+            continue;
+
+        Move_Value(row, arg); // can't change, see Is_Memo_Key_Value()
+        ++row;
+    }
+    Move_Value(row, f->out);
+
+    memo->hashes[e] = hash;
+    memo->slots[slot] = e + 1;
+    Link_Memo_Entry_Newest(memo, e);
+
+    return R_OUT;
+}
+
+
+//
+//  memoize: native [
+//
+//  {Make an ACTION! that remembers the results of calls to another ACTION!}
+//
+//      return: [action!]
+//      inner [action! word! path!]
+//          {Action to call when the arguments haven't been seen recently}
+//      /capacity
+//          {Limit how many results are remembered (default is 1000)}
+//      limit [integer!]
+//  ]
+//
+REBNATIVE(memoize)
+{
+    INCLUDE_PARAMS_OF_MEMOIZE;
+
+    REBVAL *inner = ARG(inner);
+    REBSTR *opt_inner_name;
+    const REBOOL push_refinements = FALSE;
+    if (Get_If_Word_Or_Path_Throws(
+        D_OUT,
+        &opt_inner_name,
+        inner,
+        SPECIFIED,
+        push_refinements
+    )){
+        return R_OUT_IS_THROWN;
+    }
+
+    if (not IS_ACTION(D_OUT))
+        fail (Error_Invalid(inner));
+    Move_Value(inner, D_OUT); // Frees D_OUT, and GC safe (in ARG slot)
+
+    REBCNT capacity = 1000;
+    if (REF(capacity)) {
+        if (VAL_INT64(ARG(limit)) < 1 or VAL_INT64(ARG(limit)) > 0x1000000)
+            fail (Error_Out_Of_Range(ARG(limit)));
+        capacity = VAL_INT32(ARG(limit));
+    }
+
+    // As with ENCLOSE, the paramlist is a copy of the inner's, so that its
+    // [0] element can identify the memoized action.
+    //
+    REBARR *paramlist = Copy_Array_Shallow(
+        VAL_ACT_PARAMLIST(inner), SPECIFIED
+    );
+    ARR_HEAD(paramlist)->payload.action.paramlist = paramlist;
+    SET_SER_FLAG(paramlist, ARRAY_FLAG_PARAMLIST);
+    MANAGE_ARRAY(paramlist);
+
+    // See %sysobj.r for `memoized-meta:` object template
+
+    REBVAL *example = Get_System(SYS_STANDARD, STD_MEMOIZED_META);
+
+    REBCTX *meta = Copy_Context_Shallow(VAL_CONTEXT(example));
+    Init_Void(CTX_VAR(meta, STD_MEMOIZED_META_DESCRIPTION)); // default
+    Move_Value(CTX_VAR(meta, STD_MEMOIZED_META_INNER), inner);
+    if (opt_inner_name == NULL)
+        Init_Void(CTX_VAR(meta, STD_MEMOIZED_META_INNER_NAME));
+    else
+        Init_Word(CTX_VAR(meta, STD_MEMOIZED_META_INNER_NAME), opt_inner_name);
+
+    MANAGE_ARRAY(CTX_VARLIST(meta));
+    MISC(paramlist).meta = meta;
+
+    REBACT *memoized = Make_Action(
+        paramlist,
+        &Memoizer_Dispatcher,
+        ACT_FACADE(VAL_ACTION(inner)), // same interface as inner
+        ACT_EXEMPLAR(VAL_ACTION(inner)) // same exemplar as inner
+    );
+
+    struct Reb_Memo *memo = ALLOC(struct Reb_Memo);
+    memo->capacity = capacity;
+    memo->width = 1; // the result
+    REBVAL *param = ACT_FACADE_HEAD(VAL_ACTION(inner));
+    for (; NOT_END(param); ++param) {
+        if (Is_Memo_Key_Param(param))
+            ++memo->width;
+    }
+    memo->count = 0;
+    memo->allocated = (capacity < MIN_MEMO_ENTRIES)
+        ? capacity
+        : MIN_MEMO_ENTRIES;
+    memo->mask = 1;
+    while (memo->mask < memo->allocated * 2)
+        memo->mask <<= 1;
+    memo->slots = ALLOC_N_ZEROFILL(REBCNT, memo->mask);
+    --memo->mask;
+    memo->hashes = ALLOC_N(uint32_t, memo->allocated);
+    memo->newer = ALLOC_N(REBCNT, memo->allocated);
+    memo->older = ALLOC_N(REBCNT, memo->allocated);
+    memo->newest = capacity;
+    memo->oldest = capacity;
+    memo->hits = 0;
+    memo->misses = 0;
+
+    // The entries are filled in as results come in, so start out with voids
+    // and say those are expected in the array.
+    //
+    REBCNT cells = memo->allocated * memo->width;
+    REBARR *entries = Make_Array_Core(cells, ARRAY_FLAG_VOIDS_LEGAL);
+    REBCNT n;
+    for (n = 0; n < cells; ++n)
+        Init_Void(ARR_AT(entries, n));
+    TERM_ARRAY_LEN(entries, cells);
+
+    // [0] is the inner ACTION!, [1] the entries, [2] the table in a HANDLE!
+    //
+    REBARR *info = Make_Array(3);
+    Append_Value(info, inner);
+    Init_Block(Alloc_Tail_Array(info), entries);
+    Init_Handle_Managed(
+        Alloc_Tail_Array(info),
+        memo,
+        0,
+        &Cleanup_Memo
+    );
+
+    Init_Block(ACT_BODY(memoized), info);
+
+    Move_Value(D_OUT, ACT_ARCHETYPE(memoized));
+    assert(VAL_BINDING(D_OUT) == UNBOUND);
+
+    return R_OUT;
+}
+
+
+//
+//  memo-stats: native [
+//
+//  {Get how often an action made by MEMOIZE found results it remembered}
+//
+//      return: [object!]
+//      memoized [action!]
+//  ]
+//
+REBNATIVE(memo_stats)
+{
+    INCLUDE_PARAMS_OF_MEMO_STATS;
+
+    REBACT *memoized = VAL_ACTION(ARG(memoized));
+    if (ACT_DISPATCHER(memoized) != &Memoizer_Dispatcher)
+        fail (Error_Invalid(ARG(memoized)));
+
+    RELVAL *memoization = ACT_BODY(memoized);
+    struct Reb_Memo *memo = VAL_HANDLE_POINTER(
+        struct Reb_Memo, VAL_ARRAY_AT_HEAD(memoization, 2)
+    );
+
+    REBCTX *stats = Copy_Context_Shallow(
+        VAL_CONTEXT(Get_System(SYS_STANDARD, STD_MEMO_STATS))
+    );
+    Init_Integer(CTX_VAR(stats, STD_MEMO_STATS_HITS), memo->hits);
+    Init_Integer(CTX_VAR(stats, STD_MEMO_STATS_MISSES), memo->misses);
+    Init_Integer(CTX_VAR(stats, STD_MEMO_STATS_SIZE), memo->count);
+    Init_Integer(CTX_VAR(stats, STD_MEMO_STATS_CAPACITY), memo->capacity);
+
+    Init_Object(D_OUT, stats);
+    return R_OUT;
+}
+
+
 //
 //  hijack: native [
 //
@@ -962,6 +962,8 @@ static inline REBCNT Finalize_Remove_Each(struct Remove_Each_State *res)
 
     REBCNT count = 0;
     if (ANY_ARRAY(res->data)) {
+        Note_Array_Modified(res->series); // body may have made a FIND index
+
         REBCNT len = VAL_LEN_HEAD(res->data);
 
         RELVAL *dest = VAL_ARRAY_AT(res->data);
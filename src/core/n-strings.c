@@ -328,7 +328,9 @@ REBNATIVE(checksum)
         if (sum <= 1)
             sum = 1;
 
-        REBINT hash = Hash_Bytes_Or_Uni(data, len, wide) % sum;
+        REBINT hash = cast(REBINT,
+            Hash_Bytes_Or_Uni(data, len, wide) % cast(uint32_t, sum)
+        );
         Init_Integer(D_OUT, hash);
     }
     else
@@ -123,10 +123,18 @@ REBNATIVE(exit_rebol)
 //      /on
 //          "Enable auto-recycling"
 //      /ballast
-//          "Trigger for auto-recycle (memory used)"
-//      size [integer!]
+//          "Fixed trigger for auto-recycle (memory used), BLANK! to adapt"
+//      size [integer! blank!]
 //      /torture
 //          "Constant recycle (for internal debugging)"
+//      /compact
+//          "Give memory pool segments with nothing in use back to the OS"
+//      /lazy
+//          "Enable or disable leaving sweeps of auto-recycles to allocations"
+//      lazily [logic!]
+//      /parallel
+//          "Use helper threads for marking (in builds with PARALLEL-MARK)"
+//      helpers [integer!]
 //      /watch
 //          "Monitor recycling (debug only)"
 //      /verbose
@@ -148,15 +156,30 @@ REBNATIVE(recycle)
     }
 
     if (REF(ballast)) {
-        TG_Max_Ballast = VAL_INT32(ARG(size));
-        TG_Ballast = TG_Max_Ballast;
+        if (IS_BLANK(ARG(size)))
+            GC_Fixed_Ballast = FALSE; // next full recycle picks the ballast
+        else {
+            GC_Fixed_Ballast = TRUE;
+            TG_Max_Ballast = VAL_INT32(ARG(size));
+            TG_Ballast = TG_Max_Ballast;
+        }
     }
 
     if (REF(torture)) {
         GC_Disabled = FALSE;
+        GC_Fixed_Ballast = TRUE;
         TG_Ballast = 0;
     }
 
+    if (REF(parallel)) {
+        if (VAL_INT32(ARG(helpers)) < 0)
+            fail (Error_Invalid(ARG(helpers)));
+        GC_Mark_Helpers = VAL_INT32(ARG(helpers));
+    }
+
+    if (REF(lazy))
+        GC_Lazy_Sweep = VAL_LOGIC(ARG(lazily)); // pending sweeps still finish
+
     if (GC_Disabled)
         return R_VOID; // don't give back misleading "0", since no recycle ran
 
@@ -187,6 +210,9 @@ REBNATIVE(recycle)
         count = Recycle();
     }
 
+    if (REF(compact))
+        Compact_Pools(TRUE);
+
     if (REF(watch)) {
       #if defined(NDEBUG)
         fail (Error_Debug_Only_Raw());
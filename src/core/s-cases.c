@@ -937,6 +937,27 @@ void Init_Char_Cases(void)
         if (UP_CASE(up[1]) == up[1]) UP_CASE(up[1]) = up[0];
         if (LO_CASE(up[1]) == up[1]) LO_CASE(up[0]) = up[1];
     }
+
+    // Rank of each byte when ordered by its upper case form (bytes that
+    // are the same but for case share a rank), for case-insensitive sorts
+    // of binaries and byte-sized strings.  See Sort_Bytes().
+    //
+    Byte_Case_Ranks = ALLOC_N(REBYTE, 256);
+
+    REBYTE bytes[256]; // insertion sorted by upper case form
+    for (n = 0; n < 256; ++n) {
+        int i = n;
+        for (; i > 0 and UP_CASE(bytes[i - 1]) > UP_CASE(n); --i)
+            bytes[i] = bytes[i - 1];
+        bytes[i] = cast(REBYTE, n);
+    }
+
+    REBYTE rank = 0;
+    for (n = 0; n < 256; ++n) {
+        if (n != 0 and UP_CASE(bytes[n]) != UP_CASE(bytes[n - 1]))
+            ++rank;
+        Byte_Case_Ranks[bytes[n]] = rank;
+    }
 }
 
 
@@ -947,5 +968,6 @@ void Shutdown_Char_Cases(void)
 {
     FREE_N(REBUNI, UNICODE_CASES, Upper_Cases);
     FREE_N(REBUNI, UNICODE_CASES, Lower_Cases);
+    FREE_N(REBYTE, 256, Byte_Case_Ranks);
     FREE_N(REBYTE, 34, White_Chars);
 }
@@ -140,6 +140,134 @@ REBINT Compute_CRC24(REBYTE *str, REBCNT len)
 }
 
 
+// Strings are hashed as the UTF-8 of their lowercased codepoints, no matter
+// how they are stored.  So a word's UTF-8 spelling hashes the same as a
+// Latin-1 or UCS-2 string with the same characters in any case.
+//
+// The bytes are taken 8 at a time as a 64-bit word, and mixed in the way of
+// the x64 variant of MurmurHash3.  Runs of ASCII are case-folded a whole
+// word at a time, and only other characters are decoded and lowercased one
+// by one.  The 64-bit result is folded to the 32 bits Hash_Value() gives.
+//
+// Word loads are done from bytes with shifts, so hashes don't depend on the
+// byte order of the platform.  (Compilers make them single loads.)
+//
+
+#define HASH_K1 UINT64_C(0x87C37B91114253D5)
+#define HASH_K2 UINT64_C(0x4CF5AD432745937F)
+
+#define ASCII_HIGH_BITS UINT64_C(0x8080808080808080)
+
+#define ROTL64(x,n) \
+    (((x) << (n)) | ((x) >> (64 - (n))))
+
+struct Reb_Hasher {
+    uint64_t h;
+    uint64_t pending; // bytes not yet mixed, first byte lowest
+    REBCNT shift; // bit position for next pending byte (8 * count)
+    REBCNT size; // total bytes fed in
+};
+
+inline static void Init_Hasher(struct Reb_Hasher *hs) {
+    hs->h = 0;
+    hs->pending = 0;
+    hs->shift = 0;
+    hs->size = 0;
+}
+
+inline static void Hash_Mix_Word(struct Reb_Hasher *hs, uint64_t w) {
+    w *= HASH_K1;
+    w = ROTL64(w, 31);
+    w *= HASH_K2;
+    hs->h ^= w;
+    hs->h = ROTL64(hs->h, 27) * 5 + 0x52DCE729;
+    hs->size += 8;
+}
+
+inline static void Hash_Feed_Byte(struct Reb_Hasher *hs, REBYTE b) {
+    hs->pending |= cast(uint64_t, b) << hs->shift;
+    hs->shift += 8;
+    if (hs->shift == 64) {
+        Hash_Mix_Word(hs, hs->pending);
+        hs->pending = 0;
+        hs->shift = 0;
+    }
+}
+
+static void Hash_Feed_Codepoint(struct Reb_Hasher *hs, REBUNI c) {
+    if (c < UNICODE_CASES)
+        c = LO_CASE(c);
+
+    if (c < 0x80) {
+        Hash_Feed_Byte(hs, cast(REBYTE, c));
+        return;
+    }
+
+    REBYTE encoded[8];
+    REBCNT len = Encode_UTF8_Char(encoded, c);
+    REBCNT n;
+    for (n = 0; n < len; ++n)
+        Hash_Feed_Byte(hs, encoded[n]);
+}
+
+inline static uint64_t Load_Hash_Word(const REBYTE *b) {
+    return cast(uint64_t, b[0])
+        | (cast(uint64_t, b[1]) << 8)
+        | (cast(uint64_t, b[2]) << 16)
+        | (cast(uint64_t, b[3]) << 24)
+        | (cast(uint64_t, b[4]) << 32)
+        | (cast(uint64_t, b[5]) << 40)
+        | (cast(uint64_t, b[6]) << 48)
+        | (cast(uint64_t, b[7]) << 56);
+}
+
+// Lowercase the A-Z bytes of a word known to have only ASCII bytes.  Adding
+// to a byte under 0x80 can't carry into the next one, so the high bit of
+// each byte of the sums says if it's at least 'A', or more than 'Z'.
+//
+inline static uint64_t Fold_Ascii_Word(uint64_t w) {
+    uint64_t at_least_A = w + UINT64_C(0x3F3F3F3F3F3F3F3F);
+    uint64_t above_Z = w + UINT64_C(0x2525252525252525);
+    return w | (((at_least_A & ~above_Z) & ASCII_HIGH_BITS) >> 2);
+}
+
+// Try to hash the next 8 bytes as one word, which can be done if they are
+// all ASCII and no bytes are pending from before.
+//
+inline static REBOOL Hash_Ascii_Word(
+    struct Reb_Hasher *hs,
+    const REBYTE *b
+){
+    if (hs->shift != 0)
+        return FALSE;
+
+    uint64_t w = Load_Hash_Word(b);
+    if (w & ASCII_HIGH_BITS)
+        return FALSE;
+
+    Hash_Mix_Word(hs, Fold_Ascii_Word(w));
+    return TRUE;
+}
+
+static uint32_t Finish_Hash(struct Reb_Hasher *hs) {
+    uint64_t h = hs->h;
+    if (hs->shift != 0) {
+        uint64_t w = hs->pending * HASH_K1;
+        w = ROTL64(w, 31);
+        h ^= w * HASH_K2;
+    }
+    h ^= hs->size + (hs->shift / 8);
+
+    h ^= h >> 33; // MurmurHash3's fmix64
+    h *= UINT64_C(0xFF51AFD7ED558CCD);
+    h ^= h >> 33;
+    h *= UINT64_C(0xC4CEB9FE1A85EC53);
+    h ^= h >> 33;
+
+    return cast(uint32_t, h ^ (h >> 32));
+}
+
+
 //
 //  Hash_UTF8: C
 //
@@ -148,36 +276,30 @@ REBINT Compute_CRC24(REBYTE *str, REBCNT len)
 // !!! Review taking size_t for size instead of REBCNT, but Back_Scan_UTF8
 // needs to be changed.
 //
-REBINT Hash_UTF8(const REBYTE *utf8, REBCNT size)
+uint32_t Hash_UTF8(const REBYTE *utf8, REBCNT size)
 {
-    REBINT hash =
-        cast(REBINT, size) + cast(REBINT, cast(REBYTE, LO_CASE(*utf8)));
-
-    for (; size != 0; ++utf8, --size) {
-        REBUNI n = *utf8;
+    struct Reb_Hasher hs;
+    Init_Hasher(&hs);
+
+    while (size != 0) {
+        if (size >= 8 and Hash_Ascii_Word(&hs, utf8)) {
+            utf8 += 8;
+            size -= 8;
+            continue;
+        }
 
-        if (n >= 0x80) {
-            utf8 = Back_Scan_UTF8_Char(&n, utf8, &size);
+        REBUNI c = *utf8;
+        if (c >= 0x80) {
+            utf8 = Back_Scan_UTF8_Char(&c, utf8, &size);
             assert(utf8 != NULL); // should have already been verified good
         }
+        Hash_Feed_Codepoint(&hs, c);
 
-        // Optimize `n = cast(REBYTE, LO_CASE(n))` (drop upper 8 bits)
-        // !!! Is this actually faster?
-        //
-        if (n < UNICODE_CASES)
-            n = cast(REBYTE, LO_CASE(n));
-        else
-            n = cast(REBYTE, n);
-
-        n = cast(REBYTE, (hash >> CRCSHIFTS) ^ n);
-
-        // Left shift math must use unsigned to avoid undefined behavior
-        // http://stackoverflow.com/q/3784996/211160
-        //
-        hash = cast(REBINT, MASK_CRC(cast(REBCNT, hash) << 8) ^ crc24_table[n]);
+        ++utf8;
+        --size;
     }
 
-    return hash;
+    return Finish_Hash(&hs);
 }
 
 
@@ -395,17 +517,22 @@ uint32_t Hash_Value(const RELVAL *v)
 //
 //  Make_Hash_Sequence: C
 //
+// Make a hashlist with room for `len` keys, see `struct Reb_Hash_Slot`.
+//
 REBSER *Make_Hash_Sequence(REBCNT len)
 {
-    REBCNT n = Get_Hash_Prime(len * 2); // best when 2X # of keys
-    if (n == 0) {
+    if (len > MAX_HASH_SLOTS / 2) {
         DECLARE_LOCAL (temp);
         Init_Integer(temp, len);
 
         fail (Error_Size_Limit_Raw(temp));
     }
 
-    REBSER *ser = Make_Series(n + 1, sizeof(REBCNT));
+    REBCNT n = 8;
+    while (n < len * 2) // best when 2X # of keys
+        n <<= 1;
+
+    REBSER *ser = Make_Series(n + 1, sizeof(struct Reb_Hash_Slot));
     Clear_Series(ser);
     SET_SERIES_LEN(ser, n);
 
@@ -448,13 +575,13 @@ REBSER *Hash_Block(const REBVAL *block, REBCNT skip, REBOOL cased)
 {
     REBCNT n;
     REBSER *hashlist;
-    REBCNT *hashes;
+    struct Reb_Hash_Slot *slots;
     REBARR *array = VAL_ARRAY(block);
     RELVAL *value;
 
     // Create the hash array (integer indexes):
     hashlist = Make_Hash_Sequence(VAL_LEN_AT(block));
-    hashes = SER_HEAD(REBCNT, hashlist);
+    slots = HASH_SLOTS(hashlist);
 
     value = VAL_ARRAY_AT(block);
     if (IS_END(value))
@@ -464,10 +591,10 @@ REBSER *Hash_Block(const REBVAL *block, REBCNT skip, REBOOL cased)
     while (TRUE) {
         REBCNT skip_index = skip;
 
-        REBCNT hash = Find_Key_Hashed(
+        REBCNT slot = Find_Key_Hashed(
             array, hashlist, value, VAL_SPECIFIER(block), 1, cased, 0
         );
-        hashes[hash] = (n / skip) + 1;
+        slots[slot].index = (n / skip) + 1;
 
         while (skip_index != 0) {
             value++;
@@ -534,41 +661,40 @@ REBINT Compute_IPC(REBYTE *data, REBCNT length)
 //  Hash_Bytes_Or_Uni: C
 //
 // Return a 32-bit case insensitive hash value for the string.  The
-// string does not have to be zero terminated and UTF8 is ok.
+// string does not have to be zero terminated.  Byte-sized data is taken as
+// Latin-1 (so the same characters hash the same at either width, and as
+// they would with Hash_UTF8()).
 //
-REBINT Hash_Bytes_Or_Uni(
+uint32_t Hash_Bytes_Or_Uni(
     const void *data, // REBYTE* or REBUNI*
     REBCNT len, // chars, not bytes
     REBCNT wide // 1 = byte-sized, 2 = Unicode
 ){
-    uint32_t c = 0x00000000;
-    uint32_t c2 = 0x00000000; // don't change, see [1] below
-    REBCNT n;
-    const REBYTE *b = cast(const REBYTE*, data);
-    const REBUNI *u = cast(const REBUNI*, data);
+    struct Reb_Hasher hs;
+    Init_Hasher(&hs);
 
     if (wide == 1) {
-        for(n = 0; n != len; n++) {
-            c = (c >> 8) ^ crc32_table[(c ^ LO_CASE(b[n])) & 0xff];
-        }
-    } else if (wide == 2) {
-        for(n = 0; n != len; n++) {
-            c = (c >> 8) ^ crc32_table[(c ^ LO_CASE(u[n])) & 0xff];
-
-            c2 = (c2 >> 8) ^ crc32_table[
-                (c2 ^ (LO_CASE(u[n]) >> 8)) & 0xff
-            ];
+        const REBYTE *b = cast(const REBYTE*, data);
+        while (len != 0) {
+            if (len >= 8 and Hash_Ascii_Word(&hs, b)) {
+                b += 8;
+                len -= 8;
+                continue;
+            }
+            Hash_Feed_Codepoint(&hs, *b);
+            ++b;
+            --len;
         }
     }
-    else
-        assert(wide == 1 || wide == 2);
+    else {
+        assert(wide == 2);
 
-    // [1] If wide = 2 but all chars <= 0xFF then c2 = 0, and c is the same
-    // as wide = 1
-    //
-    c ^= c2;
+        const REBUNI *u = cast(const REBUNI*, data);
+        for (; len != 0; ++u, --len)
+            Hash_Feed_Codepoint(&hs, *u);
+    }
 
-    return cast(REBINT,~c);
+    return Finish_Hash(&hs);
 }
 
 
@@ -232,6 +232,305 @@ void TO_Array(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg) {
 }
 
 
+// FIND and SELECT on big arrays are done with a hash index of the array's
+// positions, made when an array is searched a second time without being
+// changed in between.  The indexes of the arrays searched most recently are
+// kept in Root_Find_Indexes.  An index is only used while the array still
+// has ARRAY_FLAG_FIND_INDEXED, which the modify paths clear.
+//
+// Strings and binaries in an array can change without the array changing,
+// so those are only indexed (and looked up) in arrays that were deeply
+// frozen (as loaded source is) when the index was made.
+//
+// Only targets whose matches all hash the same are looked up: words (which
+// match any kind of word with the same spelling), strings and binaries of
+// the same type, characters, and integers.  An INTEGER! also matches any
+// DECIMAL!, PERCENT!, or MONEY! that is nearly equal, so arrays which have
+// those are scanned instead when the target is an integer.
+//
+// Each slot is for one position in the array (not one key, as in the hashes
+// of Hash_Block()).  Positions are put in ascending order, so probing for a
+// key meets its positions in the order a forward search would.
+//
+#define FIND_INDEX_CACHE_SIZE 16 // must be a power of 2
+#define FIND_INDEX_MIN_LEN 32 // shorter arrays are scanned
+
+enum {
+    FIND_INDEX_ARRAY, // BLOCK! of the array indexed
+    FIND_INDEX_SLOTS, // HANDLE! of the index's Reb_Hash_Slot array
+    FIND_INDEX_INEXACT, // LOGIC! of if array has inexact numbers
+    FIND_INDEX_FROZEN, // LOGIC! of if strings and binaries were indexed
+    FIND_INDEX_CANDIDATE, // HANDLE! of array searched once (not kept alive)
+    FIND_INDEX_MAX
+};
+
+
+//
+//  Startup_Find_Indexes: C
+//
+void Startup_Find_Indexes(void)
+{
+    REBCNT len = FIND_INDEX_CACHE_SIZE * FIND_INDEX_MAX;
+    REBARR *a = Make_Array(len);
+
+    REBCNT n;
+    for (n = 0; n < len; ++n)
+        Init_Blank(ARR_AT(a, n));
+    TERM_ARRAY_LEN(a, len);
+
+    Root_Find_Indexes = Init_Block(Alloc_Value(), a);
+}
+
+
+//
+//  Shutdown_Find_Indexes: C
+//
+void Shutdown_Find_Indexes(void)
+{
+    rebRelease(Root_Find_Indexes);
+    Root_Find_Indexes = NULL;
+}
+
+
+static void Cleanup_Find_Index(const REBVAL *v)
+{
+    struct Reb_Hash_Slot *slots
+        = VAL_HANDLE_POINTER(struct Reb_Hash_Slot, v);
+    FREE_N(struct Reb_Hash_Slot, VAL_HANDLE_LEN(v), slots);
+}
+
+
+//
+//  Hash_Find_Key: C
+//
+// Get the hash a value has in a find index, or FALSE if it has none.  Values
+// which can be found by a search must hash the same as the target.
+//
+static REBOOL Hash_Find_Key(uint32_t *hash_out, const RELVAL *v)
+{
+    uint32_t hash;
+
+    switch (VAL_TYPE(v)) {
+    case REB_WORD:
+    case REB_SET_WORD:
+    case REB_GET_WORD:
+    case REB_LIT_WORD:
+    case REB_REFINEMENT:
+    case REB_ISSUE:
+        *hash_out = Mix_Hash(Hash_String(VAL_WORD_SPELLING(v)));
+        return TRUE; // no type in the hash, as any kind of word can match
+
+    case REB_BINARY:
+    case REB_TEXT:
+    case REB_FILE:
+    case REB_EMAIL:
+    case REB_URL:
+    case REB_TAG:
+        hash = Hash_Bytes_Or_Uni(
+            VAL_RAW_DATA_AT(v),
+            VAL_LEN_AT(v),
+            SER_WIDE(VAL_SERIES(v))
+        );
+        break;
+
+    case REB_CHAR: {
+        REBUNI c = VAL_CHAR(v);
+        hash = c < UNICODE_CASES ? UP_CASE(c) : c;
+        break; }
+
+    case REB_INTEGER: {
+        uint64_t i = cast(uint64_t, VAL_INT64(v));
+        hash = cast(uint32_t, i) ^ cast(uint32_t, i >> 32);
+        break; }
+
+    default:
+        return FALSE;
+    }
+
+    *hash_out = Mix_Hash(hash ^ (cast(uint32_t, VAL_TYPE(v)) << 24));
+    return TRUE;
+}
+
+
+//
+//  Make_Find_Index: C
+//
+// Hash every position of the array that has a hashable value (leaving out
+// strings and binaries unless the array is frozen).  Returns the slots, with
+// a power of 2 count at least twice the array length.
+//
+static struct Reb_Hash_Slot *Make_Find_Index(
+    REBCNT *count_out,
+    REBOOL *inexact_out,
+    REBARR *array,
+    REBOOL frozen
+){
+    REBCNT len = ARR_LEN(array);
+    REBCNT count = 8;
+    while (count < len * 2)
+        count <<= 1;
+
+    struct Reb_Hash_Slot *slots
+        = ALLOC_N_ZEROFILL(struct Reb_Hash_Slot, count);
+    REBCNT mask = count - 1;
+    REBOOL inexact = FALSE;
+
+    REBCNT n;
+    for (n = 0; n < len; ++n) {
+        RELVAL *item = ARR_AT(array, n);
+        if (IS_DECIMAL(item) or IS_PERCENT(item) or IS_MONEY(item))
+            inexact = TRUE;
+
+        if (not frozen and (ANY_STRING(item) or IS_BINARY(item)))
+            continue;
+
+        uint32_t hash;
+        if (not Hash_Find_Key(&hash, item))
+            continue;
+
+        REBCNT slot = hash & mask;
+        while (slots[slot].index != 0) // empty slots have 0
+            slot = (slot + 1) & mask;
+        slots[slot].index = n + 1;
+        slots[slot].hash = hash;
+    }
+
+    *count_out = count;
+    *inexact_out = inexact;
+    return slots;
+}
+
+
+//
+//  Find_In_Index: C
+//
+// Search an array using its find index, making the index if the array was
+// searched once before.  Returns FALSE if the search can't use an index, so
+// the caller must scan.  Else gives the position found (or NOT_FOUND).
+//
+static REBOOL Find_In_Index(
+    REBCNT *index_out,
+    REBARR *array,
+    REBCNT start,
+    REBCNT end,
+    const RELVAL *target,
+    REBFLGS flags,
+    REBINT skip
+){
+    if (flags & (AM_FIND_REVERSE | AM_FIND_LAST | AM_FIND_MATCH))
+        return FALSE;
+    if (skip < 1 or ARR_LEN(array) < FIND_INDEX_MIN_LEN)
+        return FALSE;
+
+    uint32_t hash;
+    if (not Hash_Find_Key(&hash, target))
+        return FALSE;
+
+    REBCNT cache = (cast(uintptr_t, array) >> 4) & (FIND_INDEX_CACHE_SIZE - 1);
+    RELVAL *entry = ARR_AT(
+        VAL_ARRAY(Root_Find_Indexes), cache * FIND_INDEX_MAX
+    );
+
+    if (
+        not IS_BLOCK(entry + FIND_INDEX_ARRAY)
+        or VAL_ARRAY(entry + FIND_INDEX_ARRAY) != array
+        or NOT_SER_FLAG(array, ARRAY_FLAG_FIND_INDEXED)
+    ){
+        // Only arrays searched twice with no change in between are worth
+        // an index.  The candidate is a plain pointer, it's just compared
+        // and not used, and the flag tells if the array was changed since.
+        //
+        if (
+            IS_BLOCK(entry + FIND_INDEX_ARRAY)
+            and VAL_ARRAY(entry + FIND_INDEX_ARRAY) == array
+        ){
+            Init_Blank(entry + FIND_INDEX_ARRAY); // array changed, drop index
+            Init_Blank(entry + FIND_INDEX_SLOTS);
+        }
+
+        RELVAL *candidate = entry + FIND_INDEX_CANDIDATE;
+        if (
+            not IS_HANDLE(candidate)
+            or VAL_HANDLE_POINTER(REBARR, candidate) != array
+            or NOT_SER_FLAG(array, ARRAY_FLAG_FIND_INDEXED)
+        ){
+            Init_Handle_Simple(candidate, array, 0);
+            SET_SER_FLAG(array, ARRAY_FLAG_FIND_INDEXED);
+            return FALSE;
+        }
+
+        REBOOL frozen = Is_Array_Deeply_Frozen(array);
+        REBCNT count;
+        REBOOL inexact;
+        struct Reb_Hash_Slot *slots
+            = Make_Find_Index(&count, &inexact, array, frozen);
+
+        Init_Block(entry + FIND_INDEX_ARRAY, array);
+        Init_Handle_Managed(
+            entry + FIND_INDEX_SLOTS, slots, count, &Cleanup_Find_Index
+        );
+        Init_Logic(entry + FIND_INDEX_INEXACT, inexact);
+        Init_Logic(entry + FIND_INDEX_FROZEN, frozen);
+        Init_Blank(candidate);
+    }
+
+    if (IS_INTEGER(target) and VAL_LOGIC(entry + FIND_INDEX_INEXACT))
+        return FALSE;
+    if (
+        (ANY_STRING(target) or IS_BINARY(target))
+        and not VAL_LOGIC(entry + FIND_INDEX_FROZEN)
+    ){
+        return FALSE;
+    }
+
+    RELVAL *handle = entry + FIND_INDEX_SLOTS;
+    struct Reb_Hash_Slot *slots
+        = VAL_HANDLE_POINTER(struct Reb_Hash_Slot, handle);
+    REBCNT mask = VAL_HANDLE_LEN(handle) - 1;
+    REBOOL cased = did (flags & AM_FIND_CASE);
+
+    REBCNT slot = hash & mask;
+    for (; slots[slot].index != 0; slot = (slot + 1) & mask) {
+        if (slots[slot].hash != hash)
+            continue;
+
+        REBCNT index = slots[slot].index - 1;
+        if (index < start or index >= end)
+            continue;
+        if ((index - start) % cast(REBCNT, skip) != 0)
+            continue;
+
+        RELVAL *item = ARR_AT(array, index);
+        if (ANY_WORD(target)) {
+            if (not ANY_WORD(item)) // hash collision with another kind
+                continue;
+            if (cased) {
+                if (
+                    VAL_WORD_SPELLING(item) != VAL_WORD_SPELLING(target)
+                    or VAL_TYPE(item) != VAL_TYPE(target)
+                ){
+                    continue;
+                }
+            }
+            else if (VAL_WORD_CANON(item) != VAL_WORD_CANON(target))
+                continue;
+        }
+        else if (
+            VAL_TYPE(item) != VAL_TYPE(target)
+            or 0 != Cmp_Value(item, target, cased)
+        ){
+            continue;
+        }
+
+        *index_out = index; // positions are probed in ascending order
+        return TRUE;
+    }
+
+    *index_out = NOT_FOUND;
+    return TRUE;
+}
+
+
 //
 //  Find_In_Array: C
 //
@@ -257,6 +556,11 @@ REBCNT Find_In_Array(
         else
             --index;
     }
+    else {
+        REBCNT found;
+        if (Find_In_Index(&found, array, index, end, target, flags, skip))
+            return found;
+    }
 
     // Optimized find word in block
     //
@@ -357,46 +661,71 @@ REBCNT Find_In_Array(
 }
 
 
+// Blocks are sorted with a stable merge sort.  What gets sorted is a list of
+// record numbers, and the array isn't changed until their order is known.
+// So a /COMPARE or /KEY function always sees the array as it was, and if it
+// fails the array is left alone.
+//
+// With /KEY, each record's key is made just once and kept on the data stack
+// while sorting.  If all the keys are INTEGER!, DECIMAL!, TEXT! or WORD! and
+// there is no /COMPARE function, keys are compared without Cmp_Value()'s
+// dispatch on type (and DECIMAL! keys exactly, not with its fuzzy equality).
+// Enough INTEGER! or DECIMAL! keys are radix sorted.
+//
+#define SORT_RUN_LEN 16 // runs of this many are insertion sorted first
+#define SORT_RADIX_MIN_LEN 64 // fewer integer or decimal keys are merged
+
+enum Reb_Sort_Kind {
+    SORT_KIND_ANY,
+    SORT_KIND_INTEGER,
+    SORT_KIND_DECIMAL,
+    SORT_KIND_TEXT,
+    SORT_KIND_WORD
+};
+
 struct sort_flags {
     REBOOL cased;
     REBOOL reverse;
     REBCNT offset;
     REBVAL *comparator;
     REBOOL all; // !!! not used?
+    enum Reb_Sort_Kind kind;
+    REBARR *array;
+    REBCNT index; // where the first record is in the array
+    REBCNT skip; // cells per record
+    REBOOL keyed; // keys are on data stack, above dsp_keys
+    REBDSP dsp_keys;
+    const RELVAL *keys; // first key, if no /COMPARE function can move it
+    REBCNT stride; // cells from one key to the next
 };
 
 
 //
-//  Compare_Val: C
+//  Sort_Key: C
+//
+// The value that a record is sorted by.  A /COMPARE function may expand the
+// data stack or the array, so then the key is looked up each time.
 //
-static int Compare_Val(void *arg, const void *v1, const void *v2)
+inline static const RELVAL *Sort_Key(struct sort_flags *flags, REBCNT n)
 {
-    struct sort_flags *flags = cast(struct sort_flags*, arg);
-
-    // !!!! BE SURE that 64 bit large difference comparisons work
-
-    if (flags->reverse)
-        return Cmp_Value(
-            cast(const RELVAL*, v2) + flags->offset,
-            cast(const RELVAL*, v1) + flags->offset,
-            flags->cased
-        );
-    else
-        return Cmp_Value(
-            cast(const RELVAL*, v1) + flags->offset,
-            cast(const RELVAL*, v2) + flags->offset,
-            flags->cased
-        );
+    if (flags->comparator == NULL)
+        return flags->keys + n * flags->stride;
+    if (flags->keyed)
+        return DS_AT(flags->dsp_keys + 1 + n);
+    return ARR_AT(
+        flags->array, flags->index + n * flags->skip + flags->offset
+    );
 }
 
 
 //
 //  Compare_Val_Custom: C
 //
-static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
-{
-    struct sort_flags *flags = cast(struct sort_flags*, arg);
-
+static int Compare_Val_Custom(
+    struct sort_flags *flags,
+    const RELVAL *v1,
+    const RELVAL *v2
+){
     const REBOOL fully = TRUE; // error if not all arguments consumed
 
     DECLARE_LOCAL (result);
@@ -404,8 +733,8 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
         result,
         fully,
         flags->comparator,
-        flags->reverse ? v1 : v2,
-        flags->reverse ? v2 : v1,
+        cast(const REBVAL*, v2),
+        cast(const REBVAL*, v1),
         END
     )) {
         fail (Error_No_Catch_For_Throw(result));
@@ -436,6 +765,228 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 }
 
 
+//
+//  Compare_Records: C
+//
+static REBINT Compare_Records(struct sort_flags *flags, REBCNT a, REBCNT b)
+{
+    if (flags->reverse) {
+        REBCNT temp = a;
+        a = b;
+        b = temp;
+    }
+
+    const RELVAL *v1 = Sort_Key(flags, a);
+    const RELVAL *v2 = Sort_Key(flags, b);
+
+    switch (flags->kind) {
+    case SORT_KIND_INTEGER: {
+        REBI64 i1 = VAL_INT64(v1);
+        REBI64 i2 = VAL_INT64(v2);
+        return (i1 > i2) - (i1 < i2); }
+
+    case SORT_KIND_DECIMAL: { // exact, as Radix_Sort_Records() orders them
+        REBDEC d1 = VAL_DECIMAL(v1);
+        REBDEC d2 = VAL_DECIMAL(v2);
+        return (d1 > d2) - (d1 < d2); }
+
+    case SORT_KIND_TEXT:
+        return Compare_String_Vals(v1, v2, not flags->cased);
+
+    case SORT_KIND_WORD:
+        return Compare_Word(v1, v2, flags->cased);
+
+    case SORT_KIND_ANY:
+        break;
+    }
+
+    if (flags->comparator != NULL)
+        return Compare_Val_Custom(flags, v1, v2);
+
+    return Cmp_Value(v1, v2, flags->cased);
+}
+
+
+//
+//  Merge_Sort_Records: C
+//
+// Stable sort of the record numbers in `order`, using `scratch` (of the same
+// size) for merging.  Short runs are insertion sorted, then runs are merged
+// bottom up.  A merge is skipped when its two runs are already in order.
+//
+static void Merge_Sort_Records(
+    struct sort_flags *flags,
+    REBCNT *order,
+    REBCNT *scratch,
+    REBCNT count
+){
+    REBCNT lo;
+    for (lo = 0; lo < count; lo += SORT_RUN_LEN) {
+        REBCNT hi = MIN(lo + SORT_RUN_LEN, count);
+        REBCNT i;
+        for (i = lo + 1; i < hi; ++i) {
+            REBCNT n = order[i];
+            REBCNT j = i;
+            for (; j > lo and Compare_Records(flags, order[j - 1], n) > 0; --j)
+                order[j] = order[j - 1];
+            order[j] = n;
+        }
+    }
+
+    REBCNT *src = order;
+    REBCNT *dest = scratch;
+
+    REBCNT width;
+    for (width = SORT_RUN_LEN; width < count; width *= 2) {
+        for (lo = 0; lo < count; lo += 2 * width) {
+            REBCNT mid = MIN(lo + width, count);
+            REBCNT hi = MIN(lo + 2 * width, count);
+
+            if (
+                mid == hi
+                or Compare_Records(flags, src[mid - 1], src[mid]) <= 0
+            ){
+                memcpy(dest + lo, src + lo, (hi - lo) * sizeof(REBCNT));
+                continue;
+            }
+
+            REBCNT i = lo;
+            REBCNT j = mid;
+            REBCNT k = lo;
+            while (i < mid and j < hi) {
+                if (Compare_Records(flags, src[i], src[j]) <= 0)
+                    dest[k++] = src[i++]; // ties go left, so it is stable
+                else
+                    dest[k++] = src[j++];
+            }
+            while (i < mid)
+                dest[k++] = src[i++];
+            while (j < hi)
+                dest[k++] = src[j++];
+        }
+
+        REBCNT *temp = src;
+        src = dest;
+        dest = temp;
+    }
+
+    if (src != order)
+        memcpy(order, src, count * sizeof(REBCNT));
+}
+
+
+//
+//  Radix_Sort_Keys: C
+//
+// Stable LSD radix sort of 64-bit keys, a byte at a time.  If `order` isn't
+// NULL, its numbers are moved along with the keys.  Both `keys` and `order`
+// must have room for `count` more items after the ones being sorted, which
+// is used as scratch space.  Passes for bytes that are the same in all the
+// keys are skipped, so keys that fit in fewer bytes take fewer passes.
+//
+void Radix_Sort_Keys(REBU64 *keys, REBCNT *order, REBCNT count)
+{
+    if (count <= 1)
+        return;
+
+    REBCNT counts[8][256];
+    memset(counts, 0, sizeof(counts));
+
+    REBCNT n;
+    for (n = 0; n < count; ++n) {
+        REBU64 key = keys[n];
+        REBCNT b;
+        for (b = 0; b < 8; ++b, key >>= 8)
+            ++counts[b][key & 0xFF];
+    }
+
+    REBU64 *src_keys = keys;
+    REBU64 *dest_keys = keys + count;
+    REBCNT *src_order = order;
+    REBCNT *dest_order = order != NULL ? order + count : NULL;
+
+    REBCNT b;
+    for (b = 0; b < 8; ++b) {
+        REBCNT shift = b * 8;
+        if (counts[b][(src_keys[0] >> shift) & 0xFF] == count)
+            continue; // every key has the same byte here
+
+        REBCNT pos = 0;
+        REBCNT d;
+        for (d = 0; d < 256; ++d) {
+            REBCNT c = counts[b][d];
+            counts[b][d] = pos;
+            pos += c;
+        }
+
+        for (n = 0; n < count; ++n) {
+            REBCNT i = counts[b][(src_keys[n] >> shift) & 0xFF]++;
+            dest_keys[i] = src_keys[n];
+            if (order != NULL)
+                dest_order[i] = src_order[n];
+        }
+
+        REBU64 *temp_keys = src_keys;
+        src_keys = dest_keys;
+        dest_keys = temp_keys;
+
+        REBCNT *temp_order = src_order;
+        src_order = dest_order;
+        dest_order = temp_order;
+    }
+
+    if (src_keys != keys) {
+        memcpy(keys, src_keys, count * sizeof(REBU64));
+        if (order != NULL)
+            memcpy(order, src_order, count * sizeof(REBCNT));
+    }
+}
+
+
+//
+//  Radix_Sort_Records: C
+//
+// Put the record numbers in `order` in sorted order, for keys which are all
+// INTEGER! or DECIMAL!.  Each key is made into an unsigned number that sorts
+// the same way: the sign bit is flipped (and for negative decimals, all the
+// bits, since their magnitude goes the other way).
+//
+// Decimals are ordered exactly, as Compare_Records() does for blocks too
+// short to radix sort.  (Cmp_Value() would call decimals that are nearly
+// equal the same, and keep them in place.)
+//
+static void Radix_Sort_Records(
+    struct sort_flags *flags,
+    REBCNT *order,
+    REBCNT count
+){
+    REBSER *buffer = Make_Series(count * 2, sizeof(REBU64));
+    REBU64 *keys = SER_HEAD(REBU64, buffer);
+    const REBU64 sign = cast(REBU64, 1) << 63;
+
+    REBCNT n;
+    for (n = 0; n < count; ++n) {
+        const RELVAL *v = Sort_Key(flags, n);
+        REBU64 key;
+        if (flags->kind == SORT_KIND_INTEGER)
+            key = cast(REBU64, VAL_INT64(v)) ^ sign;
+        else {
+            REBDEC d = VAL_DECIMAL(v);
+            if (d == 0)
+                d = 0; // -0.0 is equal to 0.0, so must get the same key
+            memcpy(&key, &d, sizeof(REBU64));
+            key = (key & sign) ? ~key : key ^ sign;
+        }
+        keys[n] = flags->reverse ? ~key : key;
+        order[n] = n;
+    }
+
+    Radix_Sort_Keys(keys, order, count);
+
+    Free_Series(buffer);
+}
+
+
 //
 //  Sort_Block: C
 //
@@ -449,6 +1000,8 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 // limit [any-number! any-series!] {Length of series to sort}
 // /all {Compare all fields}
 // /reverse {Reverse sort order}
+// /key {Sort records by what a function returns for each of them}
+// keyer [action!]
 //
 static void Sort_Block(
     REBVAL *block,
@@ -457,7 +1010,8 @@ static void Sort_Block(
     REBVAL *compv,
     REBVAL *part,
     REBOOL all,
-    REBOOL rev
+    REBOOL rev,
+    REBVAL *keyer
 ) {
     struct sort_flags flags;
     flags.cased = ccase;
@@ -494,13 +1048,117 @@ static void Sort_Block(
     else
         skip = 1;
 
-    reb_qsort_r(
-        VAL_ARRAY_AT(block),
-        len / skip,
-        sizeof(REBVAL) * skip,
-        &flags,
-        flags.comparator != NULL ? &Compare_Val_Custom : &Compare_Val
-    );
+    if (flags.offset >= skip) // would compare a field of the next record
+        fail (Error_Out_Of_Range(compv));
+
+    REBCNT count = len / skip;
+
+    flags.array = VAL_ARRAY(block);
+    flags.index = VAL_INDEX(block);
+    flags.skip = skip;
+    flags.keyed = FALSE;
+    flags.dsp_keys = DSP;
+    flags.keys = ARR_AT(flags.array, flags.index + flags.offset);
+    flags.stride = skip;
+
+    REBCNT n;
+    if (not IS_VOID(keyer)) {
+        DECLARE_LOCAL (key);
+        for (n = 0; n < count; ++n) {
+            RELVAL *field = ARR_AT(
+                flags.array, flags.index + n * skip + flags.offset
+            ); // looked up each time, the function could expand the array
+            if (Apply_Only_Throws(
+                key,
+                TRUE, // fully
+                keyer,
+                KNOWN(field),
+                END
+            )) {
+                DS_DROP_TO(flags.dsp_keys);
+                fail (Error_No_Catch_For_Throw(key));
+            }
+            if (IS_VOID(key)) {
+                DS_DROP_TO(flags.dsp_keys);
+                fail (Error_No_Value(keyer));
+            }
+            DS_PUSH(key);
+        }
+        flags.keyed = TRUE;
+        flags.keys = DS_AT(flags.dsp_keys + 1);
+        flags.stride = 1;
+    }
+
+    flags.kind = SORT_KIND_ANY;
+    if (flags.comparator == NULL) {
+        enum Reb_Kind type = VAL_TYPE(Sort_Key(&flags, 0));
+        for (n = 1; n < count; ++n) {
+            if (VAL_TYPE(Sort_Key(&flags, n)) != type)
+                break;
+        }
+        if (n == count) {
+            if (type == REB_INTEGER)
+                flags.kind = SORT_KIND_INTEGER;
+            else if (type == REB_DECIMAL)
+                flags.kind = SORT_KIND_DECIMAL;
+            else if (type == REB_TEXT)
+                flags.kind = SORT_KIND_TEXT;
+            else if (type == REB_WORD)
+                flags.kind = SORT_KIND_WORD;
+        }
+    }
+
+    // The record numbers, and space for merging them.  These are manual
+    // series, so they will be freed if a comparison fails.
+    //
+    REBSER *numbers = Make_Series(count * 2, sizeof(REBCNT));
+    REBCNT *order = SER_HEAD(REBCNT, numbers);
+
+    if (
+        count >= SORT_RADIX_MIN_LEN
+        and (
+            flags.kind == SORT_KIND_INTEGER
+            or flags.kind == SORT_KIND_DECIMAL
+        )
+    ){
+        Radix_Sort_Records(&flags, order, count);
+    }
+    else {
+        for (n = 0; n < count; ++n)
+            order[n] = n;
+        Merge_Sort_Records(&flags, order, order + count, count);
+    }
+
+    if (flags.keyed)
+        DS_DROP_TO(flags.dsp_keys);
+
+    // A /COMPARE or /KEY function could have removed from the array.
+    //
+    if (ARR_LEN(flags.array) < flags.index + len) {
+        Free_Series(numbers);
+        fail (Error_Series_Held_Raw());
+    }
+
+    // Rare case where RELVAL bit copying is okay...moving cells around in
+    // the same array.  Nothing can run while the records are copied out.
+    //
+    RELVAL *head = ARR_AT(flags.array, flags.index);
+    RELVAL *copy = ALLOC_N(RELVAL, len);
+    memcpy(copy, head, len * sizeof(RELVAL));
+    for (n = 0; n < count; ++n)
+        memcpy(
+            head + n * skip,
+            copy + order[n] * skip,
+            skip * sizeof(RELVAL)
+        );
+    FREE_N(RELVAL, len, copy);
+
+    // A /COMPARE or /KEY function may have searched the array and made a
+    // FIND index of it after SORT's read-only check, so clear it now.
+    //
+    Note_Array_Modified(SER(flags.array));
+
+    Free_Series(numbers);
 }
 
 
@@ -514,6 +1172,8 @@ void Shuffle_Block(REBVAL *value, REBOOL secure)
     REBCNT idx = VAL_INDEX(value);
     RELVAL *data = VAL_ARRAY_HEAD(value);
 
+    Note_Array_Modified(VAL_SERIES(value));
+
     // Rare case where RELVAL bit copying is okay...between spots in the
     // same array.
     //
@@ -996,6 +1656,7 @@ REBTYPE(Array)
         UNUSED(REF(part)); // checks limit as void
         UNUSED(REF(skip)); // checks size as void
         UNUSED(REF(compare)); // checks comparator as void
+        UNUSED(REF(key)); // checks keyer as void
 
         FAIL_IF_READ_ONLY_ARRAY(array);
 
@@ -1006,7 +1667,8 @@ REBTYPE(Array)
             ARG(comparator), // (may be void if no /COMPARE)
             ARG(limit), // (may be void if no /PART)
             REF(all),
-            REF(reverse)
+            REF(reverse),
+            ARG(keyer) // (may be void if no /KEY)
         );
         Move_Value(D_OUT, value);
         return R_OUT;
@@ -105,20 +105,19 @@ REBINT Find_Key_Hashed(
     // Hashlists store a indexes into the actual data array, of where the
     // first key corresponding to that hash is.  There may be more keys
     // indicated by that hash, vying for the same slot.  So the collisions
-    // add a skip amount and keep trying:
+    // try the next slot, until an empty one is found:
     //
     // https://en.wikipedia.org/wiki/Linear_probing
     //
-    // Len and skip are co-primes, so is guaranteed that repeatedly
-    // adding skip (and subtracting len when needed) all positions are
-    // visited.  1 <= skip < len, and len is prime, so this is guaranteed.
+    // Each slot also has the hash of its key, so only keys with the same
+    // hash have to be compared.  If the key isn't found, the empty slot that
+    // is returned gets the hash, for the caller to fill in the index.
     //
-    REBCNT len = SER_LEN(hashlist);
-    REBCNT *indexes = SER_HEAD(REBCNT, hashlist);
+    REBCNT mask = SER_LEN(hashlist) - 1; // length is a power of 2
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
 
-    uint32_t hash = Hash_Value(key);
-    REBCNT slot = hash % len; // first slot to try for this hash
-    REBCNT skip = hash % (len - 1) + 1; // how much to skip by each collision
+    uint32_t hash = Mix_Hash(Hash_Value(key));
+    REBCNT slot = hash & mask; // first slot to try for this hash
 
     // Zombie slots are those which are left behind by removing items, with
     // void values that are illegal in maps, and indicate they can be reused.
@@ -128,14 +127,22 @@ REBINT Find_Key_Hashed(
     // You can store information case-insensitively in a MAP!, and it will
     // overwrite the value for at most one other key.  Reading information
     // case-insensitively out of a map can only be done if there aren't two
-    // keys with the same spelling.
+    // keys with the same spelling.  (Hashes are case-insensitive, so any
+    // synonyms will have the same hash.)
     //
     REBINT synonym_slot = -1; // no synonyms seen yet...
 
-    if (ANY_WORD(key)) {
-        REBCNT n;
-        while ((n = indexes[slot]) != 0) {
-            RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
+    REBCNT n;
+    for (; (n = slots[slot].index) != 0; slot = (slot + 1) & mask) {
+        RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
+
+        if (wide > 1 && zombie_slot == -1 && IS_VOID(k + 1))
+            zombie_slot = slot;
+
+        if (slots[slot].hash != hash)
+            continue;
+
+        if (ANY_WORD(key)) {
             if (ANY_WORD(k)) {
                 if (VAL_WORD_SPELLING(key) == VAL_WORD_SPELLING(k))
                     FOUND_EXACT;
@@ -143,18 +150,8 @@ REBINT Find_Key_Hashed(
                     if (VAL_WORD_CANON(key) == VAL_WORD_CANON(k))
                         FOUND_SYNONYM;
             }
-            if (wide > 1 && IS_VOID(k + 1) && zombie_slot == -1)
-                zombie_slot = slot;
-
-            slot += skip;
-            if (slot >= len)
-                slot -= len;
         }
-    }
-    else if (ANY_BINSTR(key)) {
-        REBCNT n;
-        while ((n = indexes[slot]) != 0) {
-            RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
+        else if (ANY_BINSTR(key)) {
             if (VAL_TYPE(k) == VAL_TYPE(key)) {
                 if (0 == Compare_String_Vals(k, key, FALSE))
                     FOUND_EXACT;
@@ -162,18 +159,8 @@ REBINT Find_Key_Hashed(
                     if (0 == Compare_String_Vals(k, key, TRUE))
                         FOUND_SYNONYM;
             }
-            if (wide > 1 && IS_VOID(k + 1) && zombie_slot == -1)
-                zombie_slot = slot;
-
-            slot += skip;
-            if (slot >= len)
-                slot -= len;
         }
-    }
-    else {
-        REBCNT n;
-        while ((n = indexes[slot]) != 0) {
-            RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
+        else {
             if (VAL_TYPE(k) == VAL_TYPE(key)) {
                 if (0 == Cmp_Value(k, key, TRUE))
                     FOUND_EXACT;
@@ -181,12 +168,6 @@ REBINT Find_Key_Hashed(
                     if (IS_CHAR(k) && 0 == Cmp_Value(k, key, FALSE))
                         FOUND_SYNONYM; // CHAR! is only non-STRING!/WORD! case
             }
-            if (wide > 1 && IS_VOID(k + 1) && zombie_slot == -1)
-                zombie_slot = slot;
-
-            slot += skip;
-            if (slot >= len)
-                slot -= len;
         }
     }
 
@@ -198,13 +179,15 @@ REBINT Find_Key_Hashed(
     if (zombie_slot != -1) { // zombie encountered; overwrite with new key
         assert(mode == 0);
         slot = zombie_slot;
-        REBCNT n = indexes[slot];
+        n = slots[slot].index;
         Derelativize(ARR_AT(array, (n - 1) * wide), key, specifier);
     }
 
+    slots[slot].hash = hash;
+
     if (mode > 1) { // append new value to the target series
         const RELVAL *src = key;
-        indexes[slot] = (ARR_LEN(array) / wide) + 1;
+        slots[slot].index = (ARR_LEN(array) / wide) + 1;
 
         REBCNT index;
         for (index = 0; index < wide; ++src, ++index)
@@ -226,7 +209,7 @@ static void Rehash_Map(REBMAP *map)
 
     if (!hashlist) return;
 
-    REBCNT *hashes = SER_HEAD(REBCNT, hashlist);
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
     REBARR *pairlist = MAP_PAIRLIST(map);
 
     REBVAL *key = KNOWN(ARR_HEAD(pairlist));
@@ -248,10 +231,10 @@ static void Rehash_Map(REBMAP *map)
             SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
         }
 
-        REBCNT hash = Find_Key_Hashed(
+        REBCNT slot = Find_Key_Hashed(
             pairlist, hashlist, key, SPECIFIED, 2, cased, 0
         );
-        hashes[hash] = n / 2 + 1;
+        slots[slot].index = n / 2 + 1;
 
         // discard zombies at end of pairlist
         //
@@ -263,29 +246,84 @@ static void Rehash_Map(REBMAP *map)
 
 
 //
-//  Expand_Hash: C
+//  Grow_Map: C
 //
-// Expand hash series. Clear it but set its tail.
+// Make room in a map's hashlist for more keys, squeezing out the zombies
+// (and only growing the hashlist if that didn't make enough room).  The
+// hashes kept in the slots are reused, no key is hashed again.
 //
-void Expand_Hash(REBSER *ser)
+static void Grow_Map(REBMAP *map)
 {
-    REBINT pnum = Get_Hash_Prime(SER_LEN(ser) + 1);
-    if (pnum == 0) {
-        DECLARE_LOCAL (temp);
-        Init_Integer(temp, SER_LEN(ser) + 1);
-        fail (Error_Size_Limit_Raw(temp));
+    REBARR *pairlist = MAP_PAIRLIST(map);
+    REBSER *hashlist = MAP_HASHLIST(map);
+
+    REBCNT len = SER_LEN(hashlist);
+    REBCNT count = ARR_LEN(pairlist) / 2;
+    REBCNT n;
+
+    // Size the hashlist before anything is moved, so that failing at the
+    // limit leaves the pairlist and the indexes in the slots consistent.
+    //
+    REBCNT live = 0;
+    for (n = 0; n < count; ++n) {
+        if (not IS_VOID(ARR_AT(pairlist, n * 2 + 1)))
+            ++live;
     }
 
-    assert(NOT_SER_FLAG(ser, SERIES_FLAG_ARRAY));
-    Remake_Series(
-        ser,
-        pnum + 1,
-        SER_WIDE(ser),
-        SERIES_FLAG_POWER_OF_2 // not(NODE_FLAG_NODE) => don't keep data
-    );
+    while (live >= len / 2) { // keep the slots no more than half full
+        if (len == MAX_HASH_SLOTS) {
+            DECLARE_LOCAL (temp);
+            Init_Integer(temp, live);
+            fail (Error_Size_Limit_Raw(temp));
+        }
+        len <<= 1;
+    }
 
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, pnum);
+    uint32_t *hashes = ALLOC_N(uint32_t, count);
+
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
+    for (n = 0; n < SER_LEN(hashlist); ++n) {
+        if (slots[n].index != 0)
+            hashes[slots[n].index - 1] = slots[n].hash;
+    }
+
+    live = 0;
+    for (n = 0; n < count; ++n) {
+        RELVAL *key = ARR_AT(pairlist, n * 2);
+        if (IS_VOID(key + 1))
+            continue; // zombie
+
+        if (live != n) {
+            Move_Value(ARR_AT(pairlist, live * 2), KNOWN(key));
+            Move_Value(ARR_AT(pairlist, live * 2 + 1), KNOWN(key + 1));
+            hashes[live] = hashes[n];
+        }
+        ++live;
+    }
+    TERM_ARRAY_LEN(pairlist, live * 2);
+
+    if (len != SER_LEN(hashlist)) {
+        assert(NOT_SER_FLAG(hashlist, SERIES_FLAG_ARRAY));
+        Remake_Series(
+            hashlist,
+            len + 1,
+            SER_WIDE(hashlist),
+            SERIES_FLAG_POWER_OF_2 // not(NODE_FLAG_NODE) => don't keep data
+        );
+    }
+    Clear_Series(hashlist);
+    SET_SERIES_LEN(hashlist, len);
+
+    slots = HASH_SLOTS(hashlist);
+    for (n = 0; n < live; ++n) {
+        REBCNT slot = hashes[n] & (len - 1);
+        while (slots[slot].index != 0)
+            slot = (slot + 1) & (len - 1);
+        slots[slot].index = n + 1;
+        slots[slot].hash = hashes[n];
+    }
+
+    FREE_N(uint32_t, count, hashes);
 }
 
 
@@ -312,11 +350,9 @@ REBCNT Find_Map_Entry(
 
     assert(hashlist);
 
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_LEN(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
-        Rehash_Map(map);
-    }
+    // Get hash table, expand it if it's half full (2 cells per entry):
+    if (ARR_LEN(pairlist) >= SER_LEN(hashlist))
+        Grow_Map(map);
 
     const REBCNT wide = 2;
     const REBYTE mode = 0; // just search for key, don't add it
@@ -324,8 +360,8 @@ REBCNT Find_Map_Entry(
         pairlist, hashlist, key, key_specifier, wide, cased, mode
     );
 
-    REBCNT *indexes = SER_HEAD(REBCNT, hashlist);
-    REBCNT n = indexes[slot];
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
+    REBCNT n = slots[slot].index;
 
     // n==0 or pairlist[(n-1)*]=~key
 
@@ -358,7 +394,7 @@ REBCNT Find_Map_Entry(
     Append_Value_Core(pairlist, key, key_specifier);
     Append_Value_Core(pairlist, val, val_specifier);
 
-    return (indexes[slot] = (ARR_LEN(pairlist) / 2));
+    return (slots[slot].index = (ARR_LEN(pairlist) / 2));
 }
 
 
@@ -517,8 +553,7 @@ void TO_Map(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
         REBSPC *specifier = VAL_SPECIFIER(arg);
 
         REBMAP *map = Make_Map(len / 2); // [key value key value...] + END
-        Append_Map(map, array, index, specifier, len);
-        Rehash_Map(map);
+        Append_Map(map, array, index, specifier, len); // keeps hashes
         Init_Map(out, map);
     }
     else if (IS_MAP(arg)) {
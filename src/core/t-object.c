@@ -432,20 +432,53 @@ REB_R PD_Context(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval)
     if (not IS_WORD(picker))
         return R_UNHANDLED;
 
-    const REBOOL always = FALSE;
-    REBCNT n = Find_Canon_In_Context(c, VAL_WORD_CANON(picker), always);
+    REBSTR *canon = VAL_WORD_CANON(picker);
+    REBARR *keylist = CTX_KEYLIST(c);
+
+    // Loops over many objects made from the same spec run the same path on
+    // contexts that share a keylist.  So remember the index each path cell
+    // found last, for that keylist.  A series freed and reused at the same
+    // address could fool the identity checks, so the key is checked too.
+    //
+    REBCNT slot = (cast(uintptr_t, pvs->param) >> 4) & (PATH_CACHE_SIZE - 1);
+    REBCNT n = 0;
+    if (
+        pvs->param != NULL
+        and TG_Path_Cache_Site[slot] == pvs->param
+        and TG_Path_Cache_Keylist[slot] == keylist
+    ){
+        n = TG_Path_Cache_Index[slot];
+        if (
+            n > CTX_LEN(c) // keylist is shared with a longer context
+            or VAL_KEY_CANON(CTX_KEY(c, n)) != canon
+            or GET_VAL_FLAG(CTX_KEY(c, n), TYPESET_FLAG_UNBINDABLE)
+        ){
+            n = 0;
+        }
+    }
 
     if (n == 0) {
-        //
-        // !!! The logic for allowing a GET-PATH! to be void if it's the last
-        // lookup that fails here is hacked in, but desirable for parity
-        // with the behavior of GET-WORD!
-        //
-        if (pvs->eval_type == REB_GET_PATH && FRM_AT_END(pvs)) {
-            Init_Void(pvs->out);
-            return R_OUT;
+        const REBOOL always = FALSE;
+        n = Find_Canon_In_Context(c, canon, always);
+
+        if (n == 0) {
+            //
+            // !!! The logic for allowing a GET-PATH! to be void if it's the
+            // last lookup that fails here is hacked in, but desirable for
+            // parity with the behavior of GET-WORD!
+            //
+            if (pvs->eval_type == REB_GET_PATH && FRM_AT_END(pvs)) {
+                Init_Void(pvs->out);
+                return R_OUT;
+            }
+            return R_UNHANDLED;
+        }
+
+        if (pvs->param != NULL) {
+            TG_Path_Cache_Site[slot] = pvs->param;
+            TG_Path_Cache_Keylist[slot] = keylist;
+            TG_Path_Cache_Index[slot] = n;
         }
-        return R_UNHANDLED;
     }
 
     if (CTX_VARS_UNAVAILABLE(c))
@@ -532,6 +532,49 @@ static int Compare_Chr(void *thunk, const void *v1, const void *v2)
 }
 
 
+//
+//  Sort_Bytes: C
+//
+// Stable counting sort of `count` records of `size` bytes, by their first
+// byte.  This is used instead of qsort() when the data is byte-sized.  Unless
+// the sort is case-sensitive, bytes are ordered by their upper case forms,
+// as in Compare_Chr(), so bytes may share a rank (see Byte_Case_Ranks).
+//
+static void Sort_Bytes(
+    REBYTE *data,
+    REBCNT count,
+    REBCNT size,
+    REBOOL ccase,
+    REBOOL rev
+){
+    REBCNT rank[256];
+    REBCNT b;
+    for (b = 0; b < 256; ++b) {
+        REBCNT r = ccase ? b : Byte_Case_Ranks[b];
+        rank[b] = rev ? 255 - r : r;
+    }
+
+    REBCNT starts[257];
+    memset(starts, 0, sizeof(starts));
+
+    REBCNT n;
+    for (n = 0; n < count; ++n)
+        ++starts[rank[data[n * size]] + 1];
+    for (b = 1; b < 257; ++b)
+        starts[b] += starts[b - 1];
+
+    REBYTE *sorted = ALLOC_N(REBYTE, count * size);
+    for (n = 0; n < count; ++n)
+        memcpy(
+            sorted + starts[rank[data[n * size]]]++ * size,
+            data + n * size,
+            size
+        );
+    memcpy(data, sorted, count * size);
+    FREE_N(REBYTE, count * size, sorted);
+}
+
+
 //
 //  Sort_String: C
 //
@@ -567,12 +610,17 @@ static void Sort_String(
             fail (Error_Invalid(skipv));
     }
 
-    // Use fast quicksort library function:
+    // Records of `skip` units are sorted by their first unit:
     if (skip > 1) len /= skip, size *= skip;
 
     if (ccase) thunk |= CC_FLAG_CASE;
     if (rev) thunk |= CC_FLAG_REVERSE;
 
+    if (SER_WIDE(VAL_SERIES(string)) == 1) {
+        Sort_Bytes(VAL_RAW_DATA_AT(string), len, size, ccase, rev);
+        return;
+    }
+
     reb_qsort_r(
         VAL_RAW_DATA_AT(string),
         len,
@@ -1589,6 +1637,9 @@ REBTYPE(String)
 
         if (REF(all)) // Not Supported
             fail (Error_Bad_Refine_Raw(ARG(all)));
+        if (REF(key)) // Not Supported
+            fail (Error_Bad_Refine_Raw(ARG(key)));
+        UNUSED(ARG(keyer));
 
         if (ANY_STRING(v) and not Is_String_ASCII(v))
             fail ("UTF-8 Everywhere: String sorting temporarily unavailable");
@@ -345,6 +345,80 @@ void Shuffle_Vector(REBVAL *vect, REBOOL secure)
 }
 
 
+//
+//  Sort_Vector: C
+//
+// Vectors are radix sorted.  Each element's bits are made into an unsigned
+// number that sorts the same way, which is undone after sorting: signed
+// integers have their sign bit flipped, and floats have all their bits
+// flipped if negative (else just the sign bit).
+//
+static void Sort_Vector(REBVAL *vect, REBCNT len, REBOOL rev)
+{
+    if (len <= 1)
+        return;
+
+    REBSER *ser = VAL_SERIES(vect);
+    REBYTE *data = SER_DATA_RAW(ser) + VAL_INDEX(vect) * SER_WIDE(ser);
+
+    REBOOL non_integer = (MISC(ser).vect_info.non_integer == 1);
+    REBOOL sign = (MISC(ser).vect_info.sign == 1);
+    REBCNT bits = MISC(ser).vect_info.bits;
+
+    REBU64 mask = (bits == 64)
+        ? ~cast(REBU64, 0)
+        : (cast(REBU64, 1) << bits) - 1;
+    REBU64 top = cast(REBU64, 1) << (bits - 1);
+
+    REBSER *buffer = Make_Series(len * 2, sizeof(REBU64));
+    REBU64 *keys = SER_HEAD(REBU64, buffer);
+
+    REBCNT n;
+    for (n = 0; n < len; ++n) {
+        REBU64 raw;
+        switch (bits) {
+        case 8: raw = cast(uint8_t*, data)[n]; break;
+        case 16: raw = cast(uint16_t*, data)[n]; break;
+        case 32: raw = cast(uint32_t*, data)[n]; break;
+        default: raw = cast(uint64_t*, data)[n]; break;
+        }
+
+        REBU64 key;
+        if (non_integer)
+            key = (raw & top) ? (~raw & mask) : (raw | top);
+        else if (sign)
+            key = raw ^ top;
+        else
+            key = raw;
+
+        keys[n] = rev ? (~key & mask) : key;
+    }
+
+    Radix_Sort_Keys(keys, NULL, len);
+
+    for (n = 0; n < len; ++n) {
+        REBU64 key = rev ? (~keys[n] & mask) : keys[n];
+
+        REBU64 raw;
+        if (non_integer)
+            raw = (key & top) ? (key ^ top) : (~key & mask);
+        else if (sign)
+            raw = key ^ top;
+        else
+            raw = key;
+
+        switch (bits) {
+        case 8: cast(uint8_t*, data)[n] = cast(uint8_t, raw); break;
+        case 16: cast(uint16_t*, data)[n] = cast(uint16_t, raw); break;
+        case 32: cast(uint32_t*, data)[n] = cast(uint32_t, raw); break;
+        default: cast(uint64_t*, data)[n] = raw; break;
+        }
+    }
+
+    Free_Series(buffer);
+}
+
+
 //
 //  Set_Vector_Value: C
 //
@@ -745,6 +819,26 @@ REBTYPE(Vector)
         Move_Value(D_OUT, D_ARG(1));
         return R_OUT; }
 
+    case SYM_SORT: {
+        INCLUDE_PARAMS_OF_SORT;
+        UNUSED(PAR(series));
+
+        FAIL_IF_READ_ONLY_SERIES(vect);
+
+        if (REF(case) or REF(skip) or REF(compare) or REF(all) or REF(key))
+            fail (Error_Bad_Refines_Raw());
+        UNUSED(ARG(size));
+        UNUSED(ARG(comparator));
+        UNUSED(ARG(keyer));
+
+        REBCNT len;
+        Partial1(value, ARG(limit), &len); // limit is void if no /PART
+        UNUSED(REF(part));
+
+        Sort_Vector(value, len, REF(reverse));
+        Move_Value(D_OUT, value);
+        return R_OUT; }
+
     default:
         break;
     }
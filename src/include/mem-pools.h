@@ -105,3 +105,12 @@
 #define MEM_BIG_SIZE 1024
 
 #define MEM_BALLAST 3000000
+
+// Unpooled series data of at least MEM_MAP_SIZE bytes is rounded up to a
+// multiple of MEM_MAP_ALIGN and mapped on its own, on platforms that have
+// mremap() (see HAS_MREMAP).
+//
+#define MEM_MAP_SIZE (1024 * 1024)
+#define MEM_MAP_ALIGN 4096
+#define ROUND_TO_MAP_ALIGN(n) \
+    (((n) + MEM_MAP_ALIGN - 1) & ~cast(REBCNT, MEM_MAP_ALIGN - 1))
@@ -73,7 +73,8 @@ inline static void SER_SUB_BIAS(REBSER *s, REBCNT b) {
 }
 
 inline static size_t SER_TOTAL(REBSER *s) {
-    return (SER_REST(s) + SER_BIAS(s)) * SER_WIDE(s);
+    // (not SER_REST(), as that leaves out any gap--see SERIES_FLAG_HAS_GAP)
+    return (s->content.dynamic.rest + SER_BIAS(s)) * SER_WIDE(s);
 }
 
 inline static size_t SER_TOTAL_IF_DYNAMIC(REBSER *s) {
@@ -173,6 +173,11 @@ Special internal defines used by RT, not Host-Kit developers:
 #ifdef TO_LINUX
     #define HAS_POSIX_SIGNAL
 
+    // Large series data gets its own pages from mmap(), so that mremap()
+    // can grow it without copying (see MEM_MAP_SIZE)
+    //
+    #define HAS_MREMAP
+
     // !!! The Atronix build introduced a differentiation between
     // a Linux build and a POSIX build, and one difference is the
     // usage of some signal functions that are not available if
@@ -93,17 +93,25 @@ struct Reb_Array {
 // marker in its tail slot, which is one past the last position that is
 // valid for writing a full REBVAL.
 
+// Arrays never have a gap, so these don't go through SER_AT() and its check
+// for one (see SERIES_FLAG_HAS_GAP).
+
 inline static RELVAL *ARR_AT(REBARR *a, REBCNT n)
-    { return SER_AT(RELVAL, cast(REBSER*, a), n); }
+    { return SER_AT_NO_GAP(RELVAL, cast(REBSER*, a), n); }
 
 inline static RELVAL *ARR_HEAD(REBARR *a)
-    { return SER_HEAD(RELVAL, cast(REBSER*, a)); }
+    { return SER_AT_NO_GAP(RELVAL, cast(REBSER*, a), 0); }
 
-inline static RELVAL *ARR_TAIL(REBARR *a)
-    { return SER_TAIL(RELVAL, cast(REBSER*, a)); }
+inline static RELVAL *ARR_TAIL(REBARR *a) {
+    REBSER *s = cast(REBSER*, a);
+    return SER_AT_NO_GAP(RELVAL, s, SER_LEN(s));
+}
 
-inline static RELVAL *ARR_LAST(REBARR *a)
-    { return SER_LAST(RELVAL, cast(REBSER*, a)); }
+inline static RELVAL *ARR_LAST(REBARR *a) {
+    REBSER *s = cast(REBSER*, a);
+    assert(SER_LEN(s) != 0);
+    return SER_AT_NO_GAP(RELVAL, s, SER_LEN(s) - 1);
+}
 
 // If you know something is a singular array a priori, then you don't have to
 // check the SERIES_INFO_HAS_DYNAMIC as you would in a generic ARR_HEAD.
@@ -140,7 +140,7 @@ static inline void INIT_CTX_KEYLIST_UNIQUE(REBCTX *c, REBARR *keylist) {
     (ARR_LEN(CTX_KEYLIST(c)) - 1)
 
 #define CTX_ROOTKEY(c) \
-    SER_HEAD(REBVAL, SER(CTX_KEYLIST(c)))
+    SER_AT_NO_GAP(REBVAL, SER(CTX_KEYLIST(c)), 0)
 
 #define CTX_TYPE(c) \
     VAL_TYPE(CTX_ARCHETYPE(c))
@@ -148,7 +148,7 @@ static inline void INIT_CTX_KEYLIST_UNIQUE(REBCTX *c, REBARR *keylist) {
 // The keys and vars are accessed by positive integers starting at 1
 //
 #define CTX_KEYS_HEAD(c) \
-    SER_AT(REBVAL, SER(CTX_KEYLIST(c)), 1) // a CTX_KEY can't hold a RELVAL
+    SER_AT_NO_GAP(REBVAL, SER(CTX_KEYLIST(c)), 1) // a CTX_KEY can't hold a RELVAL
 
 inline static REBFRM *CTX_FRAME_IF_ON_STACK(REBCTX *c) {
     assert(IS_FRAME(CTX_ARCHETYPE(c)));
@@ -525,7 +525,12 @@ enum rebol_signals {
 
     // SIG_EVENT_PORT is to-be-documented
     //
-    SIG_EVENT_PORT = 1 << 3
+    SIG_EVENT_PORT = 1 << 3,
+
+    // SIG_PROFILE asks for the stack to be sampled for the CPU profiler (see
+    // PROFILE).  It's set from a timer, which may be a unix signal handler.
+    //
+    SIG_PROFILE = 1 << 4
 };
 
 // Security flags:
@@ -507,6 +507,13 @@ inline static void Push_Action(
     // Move_Value() and Derelativize() contain the logic that generates this
     // varlist on demand, but start out assuming one is not needed.
     //
+    // So a call that never gets a varlist costs no series allocation at all;
+    // its args live in a chunk that Drop_Action_Core() gives back to the
+    // chunk stack (which keeps an emptied chunker around for reuse).  Once a
+    // varlist is made it is managed and may be referenced from anywhere, so
+    // it can't go on a free list for the next call: only the GC can tell
+    // when it's unused.
+    //
     f->varlist = NULL;
 
     // Make sure the person who pushed the function correctly sets the
@@ -547,7 +554,9 @@ inline static void Drop_Action_Core(
     // as well if it is persistent, so that the values can be modified once
     // the native code is no longer running?
     //
-    f->flags.bits &= ~DO_FLAG_NATIVE_HOLD;
+    f->flags.bits &= ~(
+        DO_FLAG_NATIVE_HOLD | DO_FLAG_TAIL_CALLED | DO_FLAG_TAIL_BLANKIFY
+    );
     if (not (f->flags.bits & DO_FLAG_FULFILLING_ARG))
         f->flags.bits &= ~DO_FLAG_BARRIER_HIT;
 
@@ -69,7 +69,7 @@ inline static REBARR *ACT_PARAMLIST(REBACT *a) {
 }
 
 #define ACT_ARCHETYPE(a) \
-    SER_AT(REBVAL, SER(ACT_PARAMLIST(a)), 0) // binding should be UNBOUND
+    SER_AT_NO_GAP(REBVAL, SER(ACT_PARAMLIST(a)), 0) // binding should be UNBOUND
 
 // Functions hold their flags in their canon value, some of which are cached
 // flags put there during Make_Action().
@@ -87,7 +87,7 @@ inline static REBARR *ACT_PARAMLIST(REBACT *a) {
 
 inline static REBVAL *ACT_PARAM(REBACT *a, REBCNT n) {
     assert(n != 0 and n < ARR_LEN(ACT_PARAMLIST(a)));
-    return SER_AT(REBVAL, SER(ACT_PARAMLIST(a)), n);
+    return SER_AT_NO_GAP(REBVAL, SER(ACT_PARAMLIST(a)), n);
 }
 
 #define ACT_NUM_PARAMS(a) \
@@ -143,7 +143,7 @@ inline static REBVAL *ACT_PARAM(REBACT *a, REBCNT n) {
 // REBVAL should be okay.
 //
 #define ACT_PARAMS_HEAD(a) \
-    SER_AT(REBVAL, SER(ACT_PARAMLIST(a)), 1)
+    SER_AT_NO_GAP(REBVAL, SER(ACT_PARAMLIST(a)), 1)
 
 
 
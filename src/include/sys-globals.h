@@ -46,6 +46,7 @@ PVAR REBINT PG_Boot_Level;  // User specified startup level
 
 PVAR REBU64 PG_Mem_Usage;   // Overall memory used
 PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
+PVAR REBU64 PG_Mem_Released; // Pool segment memory given back to the OS
 
 // In Ren-C, words are REBSER nodes (REBSTR subtype).  They may be GC'd (unless
 // they are in the %words.r list, in which case their canon forms are
@@ -70,6 +71,7 @@ PVAR REBCTX *Sys_Context;
 PVAR REBYTE *White_Chars;
 PVAR REBUNI *Upper_Cases;
 PVAR REBUNI *Lower_Cases;
+PVAR REBYTE *Byte_Case_Ranks; // order of bytes by upper case, for sorting
 
 // Other:
 PVAR REBYTE *PG_Pool_Map;   // Memory pool size map (created on boot)
@@ -85,6 +87,10 @@ PVAR REB_OPTS *Reb_Opts;
     PVAR REBOOL PG_Always_Malloc;   // For memory-related troubleshooting
 #endif
 
+#ifdef HAS_MREMAP
+    PVAR REBOOL PG_Huge_Pages; // Advise mapped series data to use huge pages
+#endif
+
 // These are some canon BLANK, TRUE, and FALSE values (and void/end cells).
 // In two-element arrays in order that those using them don't accidentally
 // pass them to routines that will increment the pointer as if they are
@@ -125,6 +131,10 @@ PVAR REBVAL *Root_Newline_Char; // '\n' as a CHAR!
 PVAR REBVAL *Root_Action_Meta;
 
 PVAR REBVAL *Root_Stats_Map;
+PVAR REBVAL *Root_Alloc_Sites; // allocation profiler tallies, see %d-stats.c
+PVAR REBVAL *Root_Profile_Stacks; // CPU profiler's sampled stacks, same file
+PVAR REBVAL *Root_Loop_Bodies; // prebound loop bodies, see %c-bind.c
+PVAR REBVAL *Root_Find_Indexes; // hash indexes of frozen arrays, %t-block.c
 
 PVAR REBVAL *Root_Stackoverflow_Error; // made in advance, avoids extra calls
 
@@ -166,13 +176,75 @@ TVAR REBI64 TG_Max_Ballast;
 TVAR REBPOL *Mem_Pools;     // Memory pool array
 TVAR REBOOL GC_Recycling;    // True when the GC is in a recycle
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
+TVAR REBOOL GC_Fixed_Ballast; // TRUE if RECYCLE/BALLAST or /TORTURE was used
+TVAR REBU64 GC_Live_Bytes; // Memory in use after the last full recycle
 TVAR REBOOL GC_Disabled;      // TRUE when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
+TVAR REBSER *GC_Roots; // Singular arrays of all API handles (see Alloc_Value)
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
+// Gap buffer for middle edits of strings, see SERIES_FLAG_HAS_GAP
+//
+TVAR REBSER *TG_Gap_Series; // The series whose gap is open (NULL if none)
+TVAR REBCNT TG_Gap_At; // Index where the gap starts
+TVAR REBCNT TG_Gap_Size; // Units of capacity in the gap
+TVAR REBCNT TG_Gap_Hits; // Edits the open gap has absorbed
+TVAR REBSER *TG_Gap_Candidate; // Last series edited in the middle, no gap
+
+// Recycle statistics, see STATS/GC
+//
+TVAR REBI64 GC_Recycles; // Number of recycles run
+TVAR REBI64 GC_Pause_Time; // Total microseconds paused in recycles
+TVAR REBI64 GC_Root_Time; // Total microseconds spent marking the root set
+TVAR REBI64 GC_Stack_Time; // ...marking from the frame stack
+TVAR REBI64 GC_Propagate_Time; // ...propagating marks to reachable series
+TVAR REBI64 GC_Sweep_Time; // ...sweeping (see Recycle_Maybe_Lazy())
+TVAR REBI64 GC_Nodes_Freed; // Series, pairings, and GOB!s freed by the GC
+TVAR REBU64 GC_Bytes_Freed; // Bytes of nodes and series data freed by the GC
+
+#define GC_PAUSE_BUCKETS 6 // recycles under 100us, 1ms, 10ms, 100ms, 1s, more
+TVAR REBI64 GC_Pauses[GC_PAUSE_BUCKETS]; // Histogram of recycle pause times
+TVAR REBCNT GC_Mark_Helpers; // Threads to help marking (if GC_PARALLEL_MARK)
+
+// Lazy sweeping of the series pool, see notes in %m-gc.c
+//
+TVAR REBOOL GC_Lazy_Sweep; // TRUE if auto-recycles leave sweeps to Make_Node
+TVAR struct rebol_mem_segment *GC_Sweep_Seg; // Next to sweep (NULL if none)
+TVAR REBOOL GC_Sweeping; // TRUE while segments are being swept
+TVAR REBSER *GC_Sweep_Keeps; // Series managed during a sweep, marked to keep
+TVAR REBSER *GC_Sweep_Deferred; // Dead series to free at a safe point
+
+// Inline caches for object/field paths, indexed by the address of the path
+// cell the field name came from.  Entries are checked before use, so stale
+// ones are harmless and need no clearing (see PD_Context())
+//
+#define PATH_CACHE_SIZE 1024 // must be a power of 2
+TVAR const RELVAL *TG_Path_Cache_Site[PATH_CACHE_SIZE];
+TVAR REBARR *TG_Path_Cache_Keylist[PATH_CACHE_SIZE];
+TVAR REBCNT TG_Path_Cache_Index[PATH_CACHE_SIZE];
+
 TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
 
+// Allocation profiler, see SAMPLE-ALLOCATIONS in %d-stats.c
+//
+TVAR REBI64 TG_Sample_Every; // Bytes of allocation per sample (0 when off)
+TVAR REBI64 TG_Sample_Countdown; // Bytes left to allocate until next sample
+TVAR struct Reb_Alloc_Sample *TG_Alloc_Samples; // Table of unfreed samples
+TVAR REBCNT TG_Alloc_Sample_Slots; // Size of TG_Alloc_Samples (power of 2)
+TVAR REBCNT TG_Alloc_Sample_Count; // Number of series in TG_Alloc_Samples
+TVAR REBSER *TG_Alloc_Site_Hashes; // Hash of each site in Root_Alloc_Sites
+TVAR REBSER *TG_Alloc_Site_Slots; // Hash table of site numbers (1-based)
+
+// CPU profiler, see PROFILE in %d-stats.c
+//
+TVAR REBOOL TG_Profiling; // TRUE while SIG_PROFILE samples are being taken
+TVAR REBSER *TG_Profile_Hashes; // Hash of each stack in Root_Profile_Stacks
+
+// Calls being timed by METRICS, see Apply_Core_Measured() in %d-stats.c
+//
+TVAR REBSER *TG_Metrics_Calls;
+
 // These variables used to be described in %task.r and were resident in an
 // array which kept them alive.  However, they were used as series, so really
 // could just be allocated manually...which also saves a dereference to get
@@ -47,6 +47,36 @@ struct Reb_Map {
     struct Reb_Array pairlist; // hashlist is held in ->link.hashlist
 };
 
+// A hashlist (also used by the set operations, see Hash_Block()) has a
+// power of 2 number of slots, probed linearly.  Each slot has the 1-based
+// index of the record whose key landed there (0 if the slot is empty), and
+// that key's hash...so probes can skip most other keys without comparing
+// them, and the table can grow without hashing any key again.
+//
+struct Reb_Hash_Slot {
+    REBCNT index;
+    uint32_t hash;
+};
+
+#define HASH_SLOTS(hashlist) \
+    SER_HEAD(struct Reb_Hash_Slot, (hashlist))
+
+#define MAX_HASH_SLOTS \
+    (cast(REBCNT, 1) << 31)
+
+// Hash_Value() results are often weak in the low bits (INTEGER! keys hash
+// to themselves), so they are mixed before being masked to a slot.  This
+// is the finalizer of MurmurHash3.
+//
+inline static uint32_t Mix_Hash(uint32_t h) {
+    h ^= h >> 16;
+    h *= 0x85EBCA6B;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35;
+    h ^= h >> 16;
+    return h;
+}
+
 inline static REBARR *MAP_PAIRLIST(REBMAP *m) {
     assert(GET_SER_FLAG(&(m)->pairlist, ARRAY_FLAG_PAIRLIST));
     return (&(m)->pairlist);
@@ -55,9 +85,6 @@ inline static REBARR *MAP_PAIRLIST(REBMAP *m) {
 #define MAP_HASHLIST(m) \
     (LINK(MAP_PAIRLIST(m)).hashlist)
 
-#define MAP_HASHES(m) \
-    SER_HEAD(MAP_HASHLIST(m))
-
 inline static REBMAP *MAP(void *p) {
     REBARR *a = ARR(p);
     assert(GET_SER_FLAG(a, ARRAY_FLAG_PAIRLIST));
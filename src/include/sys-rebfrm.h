@@ -282,6 +282,27 @@
     FLAGIT_LEFT(17)
 
 
+//=//// DO_FLAG_TAIL_CALLED ///////////////////////////////////////////////=//
+//
+// Set when the action running in a frame was swapped in for a call in tail
+// position (see Tail_Call_Throws()), so the frames of the actions that led
+// to it are gone.  Error backtraces can't show those actions, so they mark
+// the spot with `...` instead.
+//
+#define DO_FLAG_TAIL_CALLED \
+    FLAGIT_LEFT(18)
+
+
+//=//// DO_FLAG_TAIL_BLANKIFY /////////////////////////////////////////////=//
+//
+// Set along with DO_FLAG_TAIL_CALLED when one of the calls swapped in was at
+// the end of an IF or EITHER branch, which would have turned a null result
+// into a BLANK!.  The frame does that to the final result instead.
+//
+#define DO_FLAG_TAIL_BLANKIFY \
+    FLAGIT_LEFT(20)
+
+
 #if !defined(NDEBUG)
 
 //=//// DO_FLAG_FINAL_DEBUG ///////////////////////////////////////////////=//
@@ -294,7 +315,7 @@
 //
 
 #define DO_FLAG_FINAL_DEBUG \
-    FLAGIT_LEFT(18)
+    FLAGIT_LEFT(19)
 
 #endif
 
@@ -305,7 +326,7 @@
 // information in a platform aligned position of the frame.
 //
 #ifdef CPLUSPLUS_11
-    static_assert(18 < 32, "DO_FLAG_XXX too high");
+    static_assert(20 < 32, "DO_FLAG_XXX too high");
 #endif
 
 
@@ -585,6 +606,10 @@ struct Reb_Frame {
     //
     // Made relative just to have another RELVAL on hand.
     //
+    // In PATH! frames, `param` is the cell in the path array that the current
+    // picker was taken from if it is a plain WORD!, else NULL.  Dispatchers
+    // use its address to key inline caches (see PD_Context()).
+    //
     const RELVAL *param;
 
     // `args_head`
@@ -173,6 +173,24 @@
     FLAGIT_LEFT(GENERAL_SERIES_BIT + 3)
 
 
+//=//// SERIES_FLAG_HAS_GAP ///////////////////////////////////////////////=//
+//
+// A string or binary that is being edited in the middle may keep its unused
+// capacity as a "gap" at the last edit position, instead of after the tail.
+// Then a run of nearby insertions only moves the data between the edits,
+// not everything up to the tail.  The gap's position and size live in
+// TG_Gap_At and TG_Gap_Size, as only one series (TG_Gap_Series) has a gap
+// at a time.
+//
+// The gap is closed before anything gets at the data through SER_AT_RAW()
+// or SER_DATA_RAW(), so ordinary code never sees it.  Arrays never get a gap,
+// which lets ARR_AT() skip checking for one.  See Expand_Series() and
+// Close_Series_Gap().
+//
+#define SERIES_FLAG_HAS_GAP \
+    FLAGIT_LEFT(GENERAL_SERIES_BIT + 4)
+
+
 // ^-- STOP GENERIC SERIES FLAGS AT FLAGIT_LEFT(15) --^
 //
 // If a series is not an array, then the rightmost 16 bits of the series flags
@@ -181,7 +199,7 @@
 // have one).
 //
 #ifdef CPLUSPLUS_11
-    static_assert(GENERAL_SERIES_BIT + 4 < 16, "SERIES_FLAG_XXX too high");
+    static_assert(GENERAL_SERIES_BIT + 5 < 16, "SERIES_FLAG_XXX too high");
 #endif
 
 
@@ -285,6 +303,26 @@
     FLAGIT_LEFT(GENERAL_ARRAY_BIT + 6)
 
 
+//=//// ARRAY_FLAG_KEYHASH ////////////////////////////////////////////////=//
+//
+// Set on the keylist of a context with enough keys that finding a key by
+// scanning is slow.  The keylist then has a table from canon spellings to
+// key indices in its ->misc field (see Update_Keyhash()).
+//
+#define ARRAY_FLAG_KEYHASH \
+    FLAGIT_LEFT(GENERAL_ARRAY_BIT + 7)
+
+
+//=//// ARRAY_FLAG_FIND_INDEXED ///////////////////////////////////////////=//
+//
+// Set when FIND notes an array as searched, and kept while the hash index
+// it may then make of the array (see Find_In_Index()) is good.  Anything
+// that changes the array's cells clears it, see Note_Array_Modified().
+//
+#define ARRAY_FLAG_FIND_INDEXED \
+    FLAGIT_LEFT(GENERAL_ARRAY_BIT + 8)
+
+
 // ^-- STOP ARRAY FLAGS AT FLAGIT_LEFT(31) --^
 //
 // Arrays can use all the way up to the 32-bit limit on the flags (since
@@ -293,7 +331,7 @@
 // be used for anything but optimizations.
 //
 #ifdef CPLUSPLUS_11
-    static_assert(GENERAL_ARRAY_BIT + 6 < 32, "ARRAY_FLAG_XXX too high");
+    static_assert(GENERAL_ARRAY_BIT + 8 < 32, "ARRAY_FLAG_XXX too high");
 #endif
 
 
@@ -504,6 +542,16 @@
     FLAGIT_LEFT(14)
 
 
+//=//// SERIES_INFO_SAMPLED ///////////////////////////////////////////////=//
+//
+// Set on series that were picked by the allocation profiler (see the notes
+// on SAMPLE-ALLOCATIONS), so freeing them can take their bytes off the live
+// tally of the call site that made them.
+//
+#define SERIES_INFO_SAMPLED \
+    FLAGIT_LEFT(15)
+
+
 // ^-- STOP AT FLAGIT_LEFT(15) --^
 //
 // The rightmost 16 bits of the series info is used to store an 8 bit length
@@ -511,7 +559,7 @@
 // flags need to stop at FLAGIT_LEFT(15).
 //
 #ifdef CPLUSPLUS_11
-    static_assert(14 < 16, "SERIES_INFO_XXX too high");
+    static_assert(15 < 16, "SERIES_INFO_XXX too high");
 #endif
 
 
@@ -806,6 +854,11 @@ union Reb_Series_Misc {
     //
     REBCTX *meta;
 
+    // Keylists with ARRAY_FLAG_KEYHASH keep their canon-to-index table here,
+    // shared by every context that uses the keylist.
+    //
+    REBSER *keyhash;
+
     // When copying arrays, it's necessary to keep a map from source series
     // to their corresponding new copied series.  This allows multiple
     // appearances of the same identities in the source to give corresponding
@@ -829,6 +882,11 @@ union Reb_Series_Misc {
     //
     CLEANUP_CFUNC *cleaner;
 
+    // API handles are kept in a table of roots for the GC (GC_Roots), and
+    // remember their position in it so they can be removed in O(1) time.
+    //
+    REBCNT root_index;
+
     // Because a bitset can get very large, the negation state is stored
     // as a boolean in the series.  Since negating a bitset is intended
     // to affect all values, it has to be stored somewhere that all
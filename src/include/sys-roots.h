@@ -29,9 +29,9 @@
 // API REBVALs live in singular arrays (which fit inside a REBSER node, that
 // is the size of 2 REBVALs).  But they aren't kept alive by references from
 // other values, like the way that a REBARR used by a BLOCK! is kept alive.
-// They are kept alive by being roots (currently implemented with a flag
-// NODE_FLAG_ROOT, but it could also mean living in a distinct pool from
-// other series nodes).
+// They are kept alive by being roots: they carry NODE_FLAG_ROOT, and are
+// listed in the GC_Roots table so the GC can find them without scanning the
+// series pool.
 //
 // The API value content is in the single cell, with LINK().owner holding
 // a REBCTX* of the FRAME! that controls its lifetime, or EMPTY_ARRAY.  This
@@ -39,12 +39,11 @@
 // means it can be sniffed as a REBNOD* and distinguished from handles that
 // were given back with rebMalloc(), so routines can discern them.
 //
-// MISC() is currently unused, but could serve as a reference count or other
-// purpose.  It's not particularly necessary to have API handles use REBSER
+// MISC().root_index is the handle's position in GC_Roots, so that releasing
+// a handle can remove it from the table by moving the last entry into its
+// slot.  It's not particularly necessary to have API handles use REBSER
 // nodes--though the 2*sizeof(REBVAL) provides some optimality, and it
-// means that REBSER nodes can be recycled for more purposes.  But it would
-// potentially be better to have them in their own pools, because being
-// roots could be discovered without a "pre-pass" in the GC.
+// means that REBSER nodes can be recycled for more purposes.
 //
 
 // What distinguishes an API value is that it has both the NODE_FLAG_CELL and
@@ -80,14 +79,38 @@ inline static REBVAL *Alloc_Value(void)
     LINK(a).owner = (FS_TOP == NULL)
         ? UNBOUND
         : NOD(CTX_VARLIST(Context_For_Frame_May_Reify_Managed(FS_TOP)));
+
+    if (SER_FULL(GC_Roots))
+        Extend_Series(GC_Roots, 8);
+    MISC(a).root_index = SER_LEN(GC_Roots);
+    *SER_AT(REBARR*, GC_Roots, SER_LEN(GC_Roots)) = a;
+    SET_SERIES_LEN(GC_Roots, SER_LEN(GC_Roots) + 1);
+
     return v;
 }
 
+// Take an API handle's singular array out of the root table, moving the last
+// entry into the vacated slot.  (The GC's walk of the table relies on this
+// only ever moving entries from later in the table to earlier.)
+//
+inline static void Remove_Api_Root(REBARR *a)
+{
+    REBCNT index = MISC(a).root_index;
+    REBCNT last = SER_LEN(GC_Roots) - 1;
+    assert(*SER_AT(REBARR*, GC_Roots, index) == a);
+
+    REBARR *moved = *SER_AT(REBARR*, GC_Roots, last);
+    *SER_AT(REBARR*, GC_Roots, index) = moved;
+    MISC(moved).root_index = index;
+    SET_SERIES_LEN(GC_Roots, last);
+}
+
 inline static void Free_Value(REBVAL *v)
 {
     assert(Is_Api_Value(v));
 
     REBARR *a = Singular_From_Cell(v);
+    Remove_Api_Root(a);
     GC_Kill_Series(SER(a));
 }
 
@@ -263,6 +263,9 @@ inline static REBCNT SER_LEN(REBSER *s) {
 inline static void SET_SERIES_LEN(REBSER *s, REBCNT len) {
     assert(NOT_SER_FLAG(s, CONTEXT_FLAG_STACK));
 
+    if (s->header.bits & SERIES_FLAG_HAS_GAP)
+        Close_Series_Gap(s); // the gap's position is relative to the length
+
     if (s->info.bits & SERIES_INFO_HAS_DYNAMIC) {
         s->content.dynamic.len = len;
     }
@@ -275,6 +278,9 @@ inline static void SET_SERIES_LEN(REBSER *s, REBCNT len) {
 }
 
 inline static REBCNT SER_REST(REBSER *s) {
+    if (s->header.bits & SERIES_FLAG_HAS_GAP)
+        return s->content.dynamic.rest - TG_Gap_Size;
+
     if (s->info.bits & SERIES_INFO_HAS_DYNAMIC)
         return s->content.dynamic.rest;
 
@@ -290,13 +296,19 @@ inline static REBCNT SER_REST(REBSER *s) {
 // but have no element type pointer to pass in.
 //
 inline static REBYTE *SER_DATA_RAW(REBSER *s) {
-    // if updating, also update manual inlining in SER_AT_RAW
+    // if updating, also update manual inlining in SER_AT_NO_GAP_RAW
+    if (s->header.bits & SERIES_FLAG_HAS_GAP)
+        Close_Series_Gap(s);
+
     return (s->info.bits & SERIES_INFO_HAS_DYNAMIC)
         ? cast(REBYTE*, s->content.dynamic.data)
         : cast(REBYTE*, &s->content);
 }
 
-inline static REBYTE *SER_AT_RAW(REBYTE w, REBSER *s, REBCNT i) {
+// Arrays never have a gap (see SERIES_FLAG_HAS_GAP), and they are by far the
+// most accessed series, so ARR_AT() and friends use this to skip the check.
+//
+inline static REBYTE *SER_AT_NO_GAP_RAW(REBYTE w, REBSER *s, REBCNT i) {
 #if !defined(NDEBUG)
     if (w != SER_WIDE(s)) {
         //
@@ -311,6 +323,7 @@ inline static REBYTE *SER_AT_RAW(REBYTE w, REBSER *s, REBCNT i) {
             printf("SER_AT_RAW asked %d on width=%d\n", w, SER_WIDE(s));
         panic (s);
     }
+    assert(not (s->header.bits & SERIES_FLAG_HAS_GAP));
 #endif
 
     return ((w) * (i)) + ( // v-- inlining of SER_DATA_RAW
@@ -320,6 +333,12 @@ inline static REBYTE *SER_AT_RAW(REBYTE w, REBSER *s, REBCNT i) {
         );
 }
 
+inline static REBYTE *SER_AT_RAW(REBYTE w, REBSER *s, REBCNT i) {
+    if (s->header.bits & SERIES_FLAG_HAS_GAP)
+        Close_Series_Gap(s);
+
+    return SER_AT_NO_GAP_RAW(w, s, i);
+}
 
 //
 // In general, requesting a pointer into the series data requires passing in
@@ -338,6 +357,27 @@ inline static REBYTE *SER_AT_RAW(REBYTE w, REBSER *s, REBCNT i) {
 #define SER_HEAD(t,s) \
     SER_AT(t, (s), 0)
 
+#define SER_AT_NO_GAP(t,s,i) \
+    ((t*)SER_AT_NO_GAP_RAW(sizeof(t), (s), (i)))
+
+// Getting at the `n` units starting at `i` only needs a series's gap to be
+// closed if they would run into it.  Code filling in the units opened up by
+// an insertion uses this, so a run of edits can keep the gap open.
+//
+inline static REBYTE *SER_SPAN_RAW(REBYTE w, REBSER *s, REBCNT i, REBCNT n) {
+    if (
+        (s->header.bits & SERIES_FLAG_HAS_GAP)
+        and i + n <= TG_Gap_At
+    ){
+        assert(w == SER_WIDE(s));
+        return cast(REBYTE*, s->content.dynamic.data) + (w * i);
+    }
+    return SER_AT_RAW(w, s, i);
+}
+
+#define SER_SPAN(t,s,i,n) \
+    ((t*)SER_SPAN_RAW(sizeof(t), (s), (i), (n)))
+
 inline static REBYTE *SER_TAIL_RAW(size_t w, REBSER *s) {
     return SER_AT_RAW(w, s, SER_LEN(s));
 }
@@ -381,6 +421,8 @@ inline static void EXPAND_SERIES_TAIL(REBSER *s, REBCNT delta) {
 
 inline static void TERM_SEQUENCE(REBSER *s) {
     assert(NOT_SER_FLAG(s, SERIES_FLAG_ARRAY));
+    if (s->header.bits & SERIES_FLAG_HAS_GAP)
+        return; // Close_Series_Gap() terminates
     memset(SER_AT_RAW(SER_WIDE(s), s, SER_LEN(s)), 0, SER_WIDE(s));
 }
 
@@ -537,6 +579,18 @@ inline static REBOOL Is_Series_Read_Only(REBSER *s) { // may be temporary...
 // but if only one error is to be reported then this is probably the right
 // priority ordering.
 //
+// A FIND index of an array is only good until the array changes, so the
+// paths that modify series clear the array's flag for it.  Most modifying
+// actions check FAIL_IF_READ_ONLY_SERIES() first, so it does this too.  But
+// anything that rewrites cells without that check (like RANDOM's shuffle),
+// or after running user code that could search the array (like SORT/COMPARE
+// and REMOVE-EACH), has to call this itself once the cells are rewritten.
+//
+inline static void Note_Array_Modified(REBSER *s) {
+    if (GET_SER_FLAG(s, SERIES_FLAG_ARRAY))
+        CLEAR_SER_FLAG(s, ARRAY_FLAG_FIND_INDEXED);
+}
+
 inline static void FAIL_IF_READ_ONLY_SERIES(REBSER *s) {
     if (Is_Series_Read_Only(s)) {
         if (GET_SER_INFO(s, SERIES_INFO_AUTO_LOCKED))
@@ -551,6 +605,8 @@ inline static void FAIL_IF_READ_ONLY_SERIES(REBSER *s) {
         assert(GET_SER_INFO(s, SERIES_INFO_PROTECTED));
         fail (Error_Series_Protected_Raw());
     }
+
+    Note_Array_Modified(s);
 }
 
 
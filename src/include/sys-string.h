@@ -300,7 +300,7 @@ inline static REBSER *Make_Sized_String_UTF8(const char *utf8, size_t size)
 }
 
 
-inline static REBINT Hash_String(REBSTR *str)
+inline static uint32_t Hash_String(REBSTR *str)
     { return Hash_UTF8(cb_cast(STR_HEAD(str)), STR_SIZE(str)); }
 
 inline static REBSTR *Get_Type_Name(const RELVAL *value)
@@ -143,6 +143,7 @@
 %functions/enfix.test.reb
 %functions/hijack.test.reb
 %functions/invisible.test.reb
+%functions/memoize.test.reb
 %functions/redo.test.reb
 %functions/specialize.test.reb
 %math/absolute.test.reb